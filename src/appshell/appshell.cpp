@@ -311,10 +311,18 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     io::path_t stylePath = task.params[CommandLineController::ParamKey::StylePath].toString();
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
+    std::vector<std::string> jobProcessArgs;
+    for (const QString& arg : task.params.value(CommandLineController::ParamKey::JobProcessArgs).toStringList()) {
+        jobProcessArgs.push_back(arg.toStdString());
+    }
+    converter()->setJobProcessArgs(jobProcessArgs);
+
     switch (task.type) {
-    case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
-        break;
+    case CommandLineController::ConvertType::Batch: {
+        size_t jobsCount = task.params.value(CommandLineController::ParamKey::JobsCount, 1).toUInt();
+        io::path_t summaryPath = task.params[CommandLineController::ParamKey::BatchSummaryPath].toString();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, jobsCount, summaryPath);
+    } break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
         break;
@@ -341,6 +349,10 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     case CommandLineController::ConvertType::ExportScoreVideo: {
         ret = converter()->exportScoreVideo(task.inputFile, task.outputFile);
     } break;
+    case CommandLineController::ConvertType::Daemon: {
+        std::string serverName = task.params[CommandLineController::ParamKey::DaemonServerName].toString().toStdString();
+        ret = converter()->runDaemon(serverName);
+    } break;
     case CommandLineController::ConvertType::SourceUpdate: {
         std::string scoreSource = task.params[CommandLineController::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
@@ -21,6 +21,8 @@
  */
 #include "commandlinecontroller.h"
 
+#include <QSet>
+
 #include "log.h"
 #include "global/version.h"
 #include "config.h"
@@ -45,6 +47,10 @@ void CommandLineController::parse(const QStringList& args)
                                           "margin"));
 
     m_parser.addOption(QCommandLineOption({ "b", "bitrate" }, "Use with '-o <file>.mp3', sets bitrate, in kbps", "bitrate"));
+    m_parser.addOption(QCommandLineOption("audio-stems", "Use with '-o <file>.wav|.mp3|.ogg|.flac', also writes every "
+                                                         "instrument track to <file>-<track name>.<suffix>"));
+    m_parser.addOption(QCommandLineOption("audio-stems-aux", "Use with '--audio-stems', also writes the metronome "
+                                                             "and the chord symbols tracks"));
 
     m_parser.addOption(QCommandLineOption("template-mode", "Save template mode, no page size")); // and no platform and creationDate tags
     m_parser.addOption(QCommandLineOption({ "t", "test-mode" }, "Set test mode flag for all files")); // this includes --template-mode
@@ -54,6 +60,14 @@ void CommandLineController::parse(const QStringList& args)
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("jobs", "Use with '-j <file>', convert up to N files of the job at once, "
+                                                  "each in its own process", "N"));
+    m_parser.addOption(QCommandLineOption("batch-summary", "Use with '--jobs <N>', write a JSON summary of the job "
+                                                           "to 'file' instead of stdout", "file"));
+    m_parser.addOption(QCommandLineOption("converter-daemon", "Keep running and process conversion requests from stdin, "
+                                                              "see doc/converterdaemon.md"));
+    m_parser.addOption(QCommandLineOption("daemon-socket", "Use with '--converter-daemon', read requests from "
+                                                           "the local socket 'name' instead of stdin", "name"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -168,6 +182,14 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("audio-stems")) {
+        audioExportConfiguration()->setExportStems(true);
+    }
+
+    if (m_parser.isSet("audio-stems-aux")) {
+        audioExportConfiguration()->setExportAuxStems(true);
+    }
+
     notationConfiguration()->setTemplateModeEnabled(m_parser.isSet("template-mode"));
     notationConfiguration()->setTestModeEnabled(m_parser.isSet("t"));
 
@@ -212,6 +234,32 @@ void CommandLineController::apply()
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+
+        if (m_parser.isSet("jobs")) {
+            std::optional<int> val = intValue("jobs");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::JobsCount] = val.value();
+            } else {
+                LOGE() << "Option: --jobs not recognized jobs count: " << m_parser.value("jobs");
+            }
+        }
+
+        if (m_parser.isSet("batch-summary")) {
+            m_converterTask.params[CommandLineController::ParamKey::BatchSummaryPath] = m_parser.value("batch-summary");
+        }
+
+        m_converterTask.params[CommandLineController::ParamKey::JobProcessArgs] = jobProcessArgs();
+    }
+
+    if (m_parser.isSet("converter-daemon")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::Daemon;
+
+        if (m_parser.isSet("daemon-socket")) {
+            m_converterTask.params[CommandLineController::ParamKey::DaemonServerName] = m_parser.value("daemon-socket");
+        }
+
+        m_converterTask.params[CommandLineController::ParamKey::JobProcessArgs] = jobProcessArgs();
     }
 
     if (m_parser.isSet("score-media")) {
@@ -374,6 +422,43 @@ CommandLineController::ConverterTask CommandLineController::converterTask() cons
     return m_converterTask;
 }
 
+//! NOTE The options to pass to the processes of a parallel batch job: all the given options, except
+//! the ones that select the task and its files, and the ones that change the settings, that are already applied here.
+//! The style and the force mode are passed with every job
+QStringList CommandLineController::jobProcessArgs() const
+{
+    static const QSet<QString> TASK_OPTIONS = {
+        "j", "job", "jobs", "batch-summary", "converter-daemon", "daemon-socket", "o", "export-to",
+        "P", "export-score-parts", "score-media", "highlight-config", "score-meta", "score-parts", "score-parts-pdf",
+        "score-transpose", "source-update", "score-video", "S", "style", "f", "force",
+        "F", "factory-settings", "R", "revert-settings", "long-version", "session-type"
+    };
+
+    QStringList args;
+    QSet<QString> added;
+
+    for (const QString& name : m_parser.optionNames()) {
+        if (TASK_OPTIONS.contains(name) || added.contains(name)) {
+            continue;
+        }
+
+        added.insert(name);
+
+        QString option = (name.size() == 1 ? "-" : "--") + name;
+        QStringList values = m_parser.values(name);
+        if (values.isEmpty()) {
+            args << option;
+            continue;
+        }
+
+        for (const QString& value : values) {
+            args << option << value;
+        }
+    }
+
+    return args;
+}
+
 void CommandLineController::printLongVersion() const
 {
     if (Version::unstable()) {
@@ -66,7 +66,8 @@ public:
         ExportScorePartsPdf,
         ExportScoreTranspose,
         SourceUpdate,
-        ExportScoreVideo
+        ExportScoreVideo,
+        Daemon
     };
 
     enum class ParamKey {
@@ -75,6 +76,10 @@ public:
         ScoreSource,
         ScoreTransposeOptions,
         ForceMode,
+        JobsCount,
+        BatchSummaryPath,
+        DaemonServerName,
+        JobProcessArgs,
 
         // Video
     };
@@ -95,6 +100,7 @@ public:
 
 private:
     void printLongVersion() const;
+    QStringList jobProcessArgs() const;
 
     QCommandLineParser m_parser;
     ConverterTask m_converterTask;
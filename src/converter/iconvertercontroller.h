@@ -22,6 +22,9 @@
 #ifndef MU_CONVERTER_ICONVERTERCONTROLLER_H
 #define MU_CONVERTER_ICONVERTERCONTROLLER_H
 
+#include <string>
+#include <vector>
+
 #include "modularity/imoduleexport.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -35,7 +38,12 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             size_t jobsCount = 1, const io::path_t& summaryPath = io::path_t()) = 0;
+
+    //! NOTE The command line options of this process that configure the conversion (ex. image resolution, bitrate),
+    //! the processes of the jobs of a parallel batch get them too
+    virtual void setJobProcessArgs(const std::vector<std::string>& args) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -54,6 +62,9 @@ public:
     virtual Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) = 0;
 
     virtual Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
+
+    //! NOTE Serves conversion requests until "quit" or the end of input; from stdin if serverName is empty
+    virtual Ret runDaemon(const std::string& serverName = std::string()) = 0;
 };
 }
 
@@ -521,6 +521,9 @@ Ret BackendApi::doExportScoreParts(const notation::INotationPtr notation, QIODev
 {
     mu::engraving::MasterScore* score = notation->elements()->msScore()->masterScore();
 
+    //! NOTE All the parts are needed, so load them at once
+    score->loadExcerpts();
+
     QJsonArray partsObjList;
     QJsonArray partsMetaList;
     QJsonArray partsTitles;
@@ -561,6 +564,9 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
 {
     QJsonObject jsonForPdfs;
     jsonForPdfs["score"] = QString::fromStdString(scoreFileName);
+
+    masterNotation->notation()->elements()->msScore()->masterScore()->loadExcerpts();
+
     QByteArray scoreBin = processWriter(PDF_WRITER_NAME, masterNotation->notation()).val;
     jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
 
@@ -21,15 +21,34 @@
  */
 #include "convertercontroller.h"
 
+#include <cstdio>
+#include <memory>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QProcess>
+#include <QThread>
+
+#ifdef Q_OS_MACOS
+#include <libproc.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#endif
 
 #include "convertercodes.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
+#include "concurrency/taskscheduler.h"
+#include "converterdaemon.h"
+
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
 
 #include "log.h"
 
@@ -40,7 +59,66 @@ using namespace mu::notation;
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+static constexpr int BATCH_POLL_INTERVAL_MS = 20;
+
+static void forwardToStderr(const QByteArray& data)
+{
+    if (data.isEmpty()) {
+        return;
+    }
+
+    std::fwrite(data.constData(), 1, static_cast<size_t>(data.size()), stderr);
+    std::fflush(stderr);
+}
+
+//! NOTE Peak resident memory of a running process in kilobytes, 0 if unknown
+static int64_t processPeakRssKb(qint64 pid)
+{
+    if (pid <= 0) {
+        return 0;
+    }
+
+#if defined(Q_OS_LINUX)
+    QFile file(QString("/proc/%1/status").arg(pid));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    for (const QByteArray& line : file.readAll().split('\n')) {
+        if (line.startsWith("VmHWM:")) {
+            return line.mid(6).trimmed().split(' ').first().toLongLong();
+        }
+    }
+
+    return 0;
+#elif defined(Q_OS_MACOS)
+    rusage_info_v4 info;
+    if (proc_pid_rusage(static_cast<int>(pid), RUSAGE_INFO_V4, reinterpret_cast<rusage_info_t*>(&info)) != 0) {
+        return 0;
+    }
+
+    return static_cast<int64_t>(info.ri_lifetime_max_phys_footprint / 1024);
+#elif defined(Q_OS_WIN)
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (!process) {
+        return 0;
+    }
+
+    PROCESS_MEMORY_COUNTERS counters;
+    int64_t result = 0;
+    if (GetProcessMemoryInfo(process, &counters, sizeof(counters))) {
+        result = static_cast<int64_t>(counters.PeakWorkingSetSize / 1024);
+    }
+
+    CloseHandle(process);
+    return result;
+#else
+    return 0;
+#endif
+}
+
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
+                                          size_t jobsCount, const io::path_t& summaryPath)
 {
     TRACEFUNC;
 
@@ -50,6 +128,10 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
+    if (jobsCount > 1) {
+        return parallelBatchConvert(batchJob.val, stylePath, forceMode, jobsCount, summaryPath);
+    }
+
     Ret ret = make_ret(Ret::Code::Ok);
     for (const Job& job : batchJob.val) {
         ret = fileConvert(job.in, job.out, stylePath, forceMode);
@@ -62,6 +144,171 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
     return ret;
 }
 
+void ConverterController::setJobProcessArgs(const std::vector<std::string>& args)
+{
+    m_jobProcessArgs = args;
+}
+
+//! NOTE Every job is converted by a separate process of this application, at most jobsCount at a time.
+//! The scores don't share any state this way, and a failed or crashed job doesn't stop the others.
+//! The output of the jobs goes to stderr, so that stdout has only the summary
+mu::Ret ConverterController::parallelBatchConvert(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode,
+                                                  size_t jobsCount, const io::path_t& summaryPath) const
+{
+    TRACEFUNC;
+
+    QStringList commonArgs;
+    for (const std::string& arg : m_jobProcessArgs) {
+        commonArgs << QString::fromStdString(arg);
+    }
+    if (!stylePath.empty()) {
+        commonArgs << "-S" << stylePath.toQString();
+    }
+    if (forceMode) {
+        commonArgs << "-f";
+    }
+
+    struct RunningJob {
+        size_t resultIdx = 0;
+        std::unique_ptr<QProcess> process;
+        QElapsedTimer timer;
+    };
+
+    std::vector<JobResult> results;
+    results.reserve(batchJob.size());
+
+    std::list<RunningJob> running;
+    auto nextJob = batchJob.cbegin();
+
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    while (nextJob != batchJob.cend() || !running.empty()) {
+        while (running.size() < jobsCount && nextJob != batchJob.cend()) {
+            JobResult result;
+            result.job = *nextJob++;
+
+            RunningJob job;
+            job.resultIdx = results.size();
+            job.process = std::make_unique<QProcess>();
+            job.process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+            LOGI() << "start job, in: " << result.job.in << ", out: " << result.job.out;
+
+            job.timer.start();
+            job.process->start(QCoreApplication::applicationFilePath(),
+                               QStringList(commonArgs) << "-o" << result.job.out.toQString() << result.job.in.toQString());
+
+            result.started = job.process->waitForStarted();
+            results.push_back(std::move(result));
+
+            if (!results.back().started) {
+                LOGE() << "failed start job, err: " << job.process->errorString() << ", in: " << results.back().job.in;
+                continue;
+            }
+
+            running.push_back(std::move(job));
+        }
+
+        bool anyFinished = false;
+
+        for (auto it = running.begin(); it != running.end();) {
+            JobResult& result = results[it->resultIdx];
+            QProcess* process = it->process.get();
+
+            //! NOTE The peak is only known while the process exists, so it is sampled on every poll
+            result.peakRssKb = std::max(result.peakRssKb, processPeakRssKb(process->processId()));
+
+            process->waitForFinished(0);
+            forwardToStderr(process->readAllStandardOutput());
+
+            if (process->state() != QProcess::NotRunning) {
+                ++it;
+                continue;
+            }
+
+            result.wallTimeMs = it->timer.elapsed();
+            result.crashed = process->exitStatus() == QProcess::CrashExit;
+            result.exitCode = process->exitCode();
+
+            if (result.crashed || result.exitCode != 0) {
+                LOGE() << "failed convert, exit code: " << result.exitCode << (result.crashed ? " (crashed)" : "")
+                       << ", in: " << result.job.in << ", out: " << result.job.out;
+            }
+
+            it = running.erase(it);
+            anyFinished = true;
+        }
+
+        if (!anyFinished && !running.empty()) {
+            QThread::msleep(BATCH_POLL_INTERVAL_MS);
+        }
+    }
+
+    Ret ret = writeBatchSummary(results, totalTimer.elapsed(), summaryPath);
+    if (!ret) {
+        return ret;
+    }
+
+    for (const JobResult& result : results) {
+        if (!result.started || result.crashed || result.exitCode != 0) {
+            return make_ret(Err::BatchJobFailed);
+        }
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::writeBatchSummary(const std::vector<JobResult>& results, int64_t wallTimeMs,
+                                               const io::path_t& summaryPath) const
+{
+    QJsonArray jobs;
+    int failedCount = 0;
+
+    for (const JobResult& result : results) {
+        bool ok = result.started && !result.crashed && result.exitCode == 0;
+        if (!ok) {
+            ++failedCount;
+        }
+
+        QJsonObject obj;
+        obj["in"] = result.job.in.toQString();
+        obj["out"] = result.job.out.toQString();
+        obj["ok"] = ok;
+        obj["started"] = result.started;
+        obj["crashed"] = result.crashed;
+        obj["exitCode"] = result.exitCode;
+        obj["wallTimeMs"] = static_cast<qint64>(result.wallTimeMs);
+        obj["peakRssKb"] = static_cast<qint64>(result.peakRssKb);
+        jobs.append(obj);
+    }
+
+    QJsonObject summary;
+    summary["jobsCount"] = static_cast<int>(results.size());
+    summary["failedCount"] = failedCount;
+    summary["wallTimeMs"] = static_cast<qint64>(wallTimeMs);
+    summary["jobs"] = jobs;
+
+    QFile file;
+    bool ok = false;
+    if (!summaryPath.empty()) {
+        file.setFileName(summaryPath.toQString());
+        ok = file.open(QFile::WriteOnly);
+    } else {
+        ok = file.open(stdout, QFile::WriteOnly);
+    }
+
+    if (!ok) {
+        LOGE() << "failed open batch summary file, path: " << summaryPath;
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    file.write(QJsonDocument(summary).toJson());
+    file.close();
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC;
@@ -92,7 +339,7 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
         ret = convertFullNotation(writer, notationProject->masterNotation()->notation(), out);
     }
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const mu::io::path_t& out, const mu::io::path_t& stylePath,
@@ -117,6 +364,9 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const m
         return make_ret(Err::InFileFailedLoad);
     }
 
+    //! NOTE All the parts are needed, so load them at once
+    notationProject->masterNotation()->notation()->elements()->msScore()->masterScore()->loadExcerpts();
+
     if (suffix == PDF_SUFFIX) {
         ret = convertScorePartsToPdf(writer, notationProject->masterNotation(), out);
     } else if (suffix == PNG_SUFFIX) {
@@ -178,7 +428,7 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
+    auto writePage = [&](size_t i, const INotationWriter::Options& pageOptions) -> Ret {
         const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
         QFile file(filePath);
@@ -186,9 +436,8 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
             return make_ret(Err::OutFileFailedOpen);
         }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        INotationWriter::Options options = pageOptions;
+        options[INotationWriter::OptionKey::PAGE_NUMBER] = Val(static_cast<int>(i));
 
         file.setProperty("path", out.toQString());
 
@@ -199,6 +448,63 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
         }
 
         file.close();
+
+        return make_ret(Ret::Code::Ok);
+    };
+
+    const PageList pages = notation->elements()->pages();
+    const size_t pageCount = pages.size();
+
+    //! NOTE Images are drawn through a QPixmap, that can be used only in the main thread,
+    //! and they cache the drawn pixmap in themselves
+    auto hasImages = [&pages]() {
+        for (const mu::engraving::Page* page : pages) {
+            for (const mu::engraving::EngravingItem* item : page->elements()) {
+                if (item->isImage()) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    if (pageCount < 2 || !writer->supportsParallelPageWrite() || hasImages()) {
+        for (size_t i = 0; i < pageCount; i++) {
+            Ret ret = writePage(i, INotationWriter::Options());
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
+    //! NOTE Every page is painted into its own image or stream on the task scheduler threads.
+    //! The state shared by the pages (pixel ratio, printing mode) is set up once here and is not changed while painting
+    INotationWriter::Options options;
+    writer->beginParallelPageWrite(notation, options);
+
+    //! NOTE The header and footer texts are shared by the pages, so they are laid out for every page here, before painting
+    const std::vector<mu::engraving::Page*>& scorePages = notation->elements()->msScore()->pages();
+    for (mu::engraving::Page* page : scorePages) {
+        page->layoutHeaderFooterCopies();
+    }
+
+    std::vector<Ret> results(pageCount);
+    TaskScheduler::instance()->parallel_for(size_t(0), pageCount, [&](size_t i) {
+        results[i] = writePage(i, options);
+    }, TaskPriority::Background, size_t(1));
+
+    for (mu::engraving::Page* page : scorePages) {
+        page->clearHeaderFooterCopies();
+    }
+
+    writer->endParallelPageWrite(notation, options);
+
+    for (const Ret& ret : results) {
+        if (!ret) {
+            return ret;
+        }
     }
 
     return make_ret(Ret::Code::Ok);
@@ -359,3 +665,16 @@ mu::Ret ConverterController::updateSource(const io::path_t& in, const std::strin
 
     return BackendApi::updateSource(in, newSource, forceMode);
 }
+
+mu::Ret ConverterController::runDaemon(const std::string& serverName)
+{
+    TRACEFUNC;
+
+    ConverterDaemon daemon;
+
+    if (serverName.empty()) {
+        return daemon.runOnStdin();
+    }
+
+    return daemon.runOnLocalSocket(QString::fromStdString(serverName));
+}
@@ -23,6 +23,7 @@
 #define MU_CONVERTER_CONVERTERCONTROLLER_H
 
 #include <list>
+#include <vector>
 
 #include "../iconvertercontroller.h"
 
@@ -47,7 +48,9 @@ public:
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     size_t jobsCount = 1, const io::path_t& summaryPath = io::path_t()) override;
+    void setJobProcessArgs(const std::vector<std::string>& args) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -67,6 +70,8 @@ public:
 
     Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
+    Ret runDaemon(const std::string& serverName = std::string()) override;
+
 private:
 
     struct Job {
@@ -76,8 +81,21 @@ private:
 
     using BatchJob = std::list<Job>;
 
+    struct JobResult {
+        Job job;
+        bool started = false;
+        bool crashed = false;
+        int exitCode = 0;
+        int64_t wallTimeMs = 0;
+        int64_t peakRssKb = 0;
+    };
+
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
 
+    Ret parallelBatchConvert(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode, size_t jobsCount,
+                             const io::path_t& summaryPath) const;
+    Ret writeBatchSummary(const std::vector<JobResult>& results, int64_t wallTimeMs, const io::path_t& summaryPath) const;
+
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
@@ -86,6 +104,8 @@ private:
                                const io::path_t& out) const;
     Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const io::path_t& out) const;
+
+    std::vector<std::string> m_jobProcessArgs;
 };
 }
 
@@ -0,0 +1,334 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "converterdaemon.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+#include "convertercodes.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::converter;
+
+static const QString TYPE_KEY("type");
+static const QString ID_KEY("id");
+
+//! NOTE Initialized with the statics of the application, so about when the process starts
+static const std::chrono::steady_clock::time_point PROCESS_START_TIME = std::chrono::steady_clock::now();
+
+static int duplicateFd(int fd)
+{
+#ifdef Q_OS_WIN
+    return _dup(fd);
+#else
+    return ::dup(fd);
+#endif
+}
+
+static int redirectFd(int from, int to)
+{
+#ifdef Q_OS_WIN
+    return _dup2(from, to);
+#else
+    return ::dup2(from, to);
+#endif
+}
+
+//! NOTE Shared by the stdin reader thread and the main thread,
+//! the lines are handled on the main thread only
+struct StdinLines
+{
+    std::function<void(const QByteArray&)> onLine;
+    std::function<void()> onFinished;
+};
+
+mu::Ret ConverterDaemon::runOnStdin()
+{
+    TRACEFUNC;
+
+    //! NOTE The responses get their own copy of stdout,
+    //! everything else written to stdout (e.g. the log) goes to stderr
+    std::cout.flush();
+    std::fflush(stdout);
+
+    int responsesFd = duplicateFd(fileno(stdout));
+    if (responsesFd < 0 || redirectFd(fileno(stderr), fileno(stdout)) < 0) {
+        LOGE() << "failed redirect stdout";
+        return make_ret(Err::DaemonFailedListen, "failed redirect stdout");
+    }
+
+    QFile responses;
+    if (!responses.open(responsesFd, QIODevice::WriteOnly | QIODevice::Unbuffered, QFileDevice::AutoCloseHandle)) {
+        LOGE() << "failed open responses, err: " << responses.errorString();
+        return make_ret(Err::DaemonFailedListen, responses.errorString().toStdString());
+    }
+
+    auto writeResponse = [&responses](const QByteArray& response) {
+        responses.write(response + '\n');
+    };
+
+    writeResponse(readyMessage());
+
+    QEventLoop loop;
+    bool quit = false;
+
+    std::shared_ptr<StdinLines> lines = std::make_shared<StdinLines>();
+    lines->onLine = [this, &loop, &quit, &writeResponse](const QByteArray& line) {
+        if (quit || line.isEmpty()) {
+            return;
+        }
+
+        writeResponse(processRequest(line, quit));
+
+        if (quit) {
+            loop.quit();
+        }
+    };
+    lines->onFinished = [&loop]() {
+        loop.quit();
+    };
+
+    //! NOTE Stdin is read on its own thread, so that the event loop keeps running between the requests
+    //! (QSocketNotifier doesn't support stdin on Windows). The thread stays blocked in getline after quit,
+    //! so it's detached, and it only posts the lines to the main thread
+    std::thread reader([lines]() {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            QByteArray data = QByteArray::fromStdString(line).trimmed();
+            QMetaObject::invokeMethod(qApp, [lines, data]() {
+                if (lines->onLine) {
+                    lines->onLine(data);
+                }
+            }, Qt::QueuedConnection);
+        }
+
+        QMetaObject::invokeMethod(qApp, [lines]() {
+            if (lines->onFinished) {
+                lines->onFinished();
+            }
+        }, Qt::QueuedConnection);
+    });
+    reader.detach();
+
+    loop.exec();
+
+    lines->onLine = nullptr;
+    lines->onFinished = nullptr;
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterDaemon::runOnLocalSocket(const QString& serverName)
+{
+    TRACEFUNC;
+
+    //! NOTE A socket left by a crashed daemon would make listen fail
+    QLocalServer::removeServer(serverName);
+
+    QLocalServer server;
+    if (!server.listen(serverName)) {
+        LOGE() << "failed listen, name: " << serverName << ", err: " << server.errorString();
+        return make_ret(Err::DaemonFailedListen, server.errorString().toStdString());
+    }
+
+    LOGI() << "listening, name: " << server.fullServerName();
+
+    QEventLoop loop;
+    bool quit = false;
+    QLocalSocket* client = nullptr;
+
+    //! NOTE Clients are served one at a time, the conversions share the application state anyway.
+    //! The others wait in the pending connections until the current one disconnects
+    std::function<void()> serveNextClient = [&]() {
+        if (quit || client || !server.hasPendingConnections()) {
+            return;
+        }
+
+        client = server.nextPendingConnection();
+
+        QObject::connect(client, &QLocalSocket::readyRead, &loop, [&]() {
+            while (!quit && client && client->canReadLine()) {
+                QByteArray line = client->readLine().trimmed();
+                if (line.isEmpty()) {
+                    continue;
+                }
+
+                client->write(processRequest(line, quit) + '\n');
+                client->flush();
+            }
+
+            if (quit) {
+                loop.quit();
+            }
+        });
+
+        QObject::connect(client, &QLocalSocket::disconnected, &loop, [&]() {
+            client->deleteLater();
+            client = nullptr;
+            serveNextClient();
+        });
+
+        client->write(readyMessage() + '\n');
+        client->flush();
+    };
+
+    QObject::connect(&server, &QLocalServer::newConnection, &loop, serveNextClient);
+
+    loop.exec();
+
+    if (client) {
+        QObject::disconnect(client, nullptr, &loop, nullptr);
+        client->waitForBytesWritten();
+        client->disconnectFromServer();
+        delete client;
+    }
+
+    server.close();
+
+    return make_ret(Ret::Code::Ok);
+}
+
+QByteArray ConverterDaemon::readyMessage()
+{
+    using namespace std::chrono;
+
+    if (m_startupMs < 0) {
+        m_startupMs = duration_cast<milliseconds>(steady_clock::now() - PROCESS_START_TIME).count();
+    }
+
+    QJsonObject obj;
+    obj["ready"] = true;
+    obj["startupMs"] = static_cast<qint64>(m_startupMs);
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact);
+}
+
+QByteArray ConverterDaemon::processRequest(const QByteArray& line, bool& quit)
+{
+    QJsonObject response;
+
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(line, &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        Ret ret = make_ret(Err::DaemonRequestFailedParse, err.errorString().toStdString());
+        response["ok"] = false;
+        response["code"] = ret.code();
+        response["error"] = QString::fromStdString(ret.text());
+        return QJsonDocument(response).toJson(QJsonDocument::Compact);
+    }
+
+    QJsonObject request = doc.object();
+    QString type = request.value(TYPE_KEY).toString("convert");
+
+    if (request.contains(ID_KEY)) {
+        response[ID_KEY] = request.value(ID_KEY);
+    }
+
+    if (type == "quit") {
+        quit = true;
+        response["ok"] = true;
+        return QJsonDocument(response).toJson(QJsonDocument::Compact);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    Ret ret = processJob(type, request);
+
+    response["ok"] = ret.success();
+    response["code"] = ret.code();
+    if (!ret) {
+        response["error"] = QString::fromStdString(ret.toString());
+    }
+    response["timeMs"] = static_cast<qint64>(timer.elapsed());
+    response["warm"] = m_processedJobsCount > 0;
+
+    ++m_processedJobsCount;
+
+    //! NOTE Don't keep the last score in memory until the next request
+    globalContext()->setCurrentProject(nullptr);
+
+    return QJsonDocument(response).toJson(QJsonDocument::Compact);
+}
+
+mu::Ret ConverterDaemon::processJob(const QString& type, const QJsonObject& request)
+{
+    io::path_t in = request.value("in").toString();
+    io::path_t out = request.value("out").toString();
+    io::path_t stylePath = request.value("style").toString();
+    bool forceMode = request.value("force").toBool();
+
+    if (type == "convert") {
+        return converter()->fileConvert(in, out, stylePath, forceMode);
+    } else if (type == "batch") {
+        size_t jobsCount = static_cast<size_t>(std::max(request.value("jobs").toInt(1), 1));
+        io::path_t summaryPath = request.value("summary").toString();
+        if (jobsCount > 1 && summaryPath.empty()) {
+            //! NOTE The summary would be mixed with the responses otherwise
+            return make_ret(Err::DaemonRequestFailedParse, "parallel batch requires \"summary\"");
+        }
+        return converter()->batchConvert(in, stylePath, forceMode, jobsCount, summaryPath);
+    } else if (type == "convert-parts") {
+        return converter()->convertScoreParts(in, out, stylePath, forceMode);
+    } else if (type == "score-media") {
+        io::path_t highlightConfigPath = request.value("highlight-config").toString();
+        return converter()->exportScoreMedia(in, out, highlightConfigPath, stylePath, forceMode);
+    } else if (type == "score-meta") {
+        return converter()->exportScoreMeta(in, out, stylePath, forceMode);
+    } else if (type == "score-parts") {
+        return converter()->exportScoreParts(in, out, stylePath, forceMode);
+    } else if (type == "score-parts-pdf") {
+        return converter()->exportScorePartsPdfs(in, out, stylePath, forceMode);
+    } else if (type == "score-transpose") {
+        std::string options = request.value("options").toString().toStdString();
+        return converter()->exportScoreTranspose(in, out, options, stylePath, forceMode);
+    } else if (type == "score-video") {
+        return converter()->exportScoreVideo(in, out);
+    } else if (type == "source-update") {
+        std::string source = request.value("source").toString().toStdString();
+        return converter()->updateSource(in, source, forceMode);
+    }
+
+    return make_ret(Err::ConvertTypeUnknown, type.toStdString());
+}
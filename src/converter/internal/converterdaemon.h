@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_CONVERTERDAEMON_H
+#define MU_CONVERTER_CONVERTERDAEMON_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QString>
+
+#include "modularity/ioc.h"
+#include "context/iglobalcontext.h"
+#include "../iconvertercontroller.h"
+
+namespace mu::converter {
+//! NOTE Long-lived converter: reads requests from stdin or a local socket and runs them
+//! in the same, already initialized, application. See doc/converterdaemon.md for the protocol
+class ConverterDaemon
+{
+    INJECT(converter, IConverterController, converter)
+    INJECT(converter, context::IGlobalContext, globalContext)
+
+public:
+    ConverterDaemon() = default;
+
+    Ret runOnStdin();
+    Ret runOnLocalSocket(const QString& serverName);
+
+private:
+    QByteArray processRequest(const QByteArray& line, bool& quit);
+    Ret processJob(const QString& type, const QJsonObject& request);
+    QByteArray readyMessage();
+
+    size_t m_processedJobsCount = 0;
+    long long m_startupMs = -1;
+};
+}
+
+#endif // MU_CONVERTER_CONVERTERDAEMON_H
@@ -0,0 +1,304 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "io/buffer.h"
+#include "io/dir.h"
+#include "io/file.h"
+#include "serialization/json.h"
+
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/compat/writescorehook.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+#include "engraving/infrastructure/paint.h"
+#include "engraving/libmscore/chord.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/measure.h"
+#include "engraving/libmscore/note.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/segment.h"
+
+#include "nullpaintprovider.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//! NOTE Measures the layout hot path over the vtest corpus:
+//!   layout   - full Score::doLayout
+//!   relayout - Score::doLayoutRange of the measure after a single note edit
+//!   spacing  - Shape::minHorizontalDistance of all the neighbouring segments of every staff
+//!   paint    - painting of all pages into a null paint provider
+//!   read     - reading the .mscx/.mscz file
+//!   write    - writing the .mscx into memory
+//! Every score is measured several times, the median is taken per score,
+//! and the percentiles over all scores are reported.
+//!
+//! Run with --gtest_filter=Engraving_LayoutBenchmarks.*
+//! ENGRAVING_BENCHMARKS_SCORES - the directory with the scores (vtest/scores by default)
+//! ENGRAVING_BENCHMARKS_OUTPUT - the path of the JSON with the results (engraving_benchmarks.json by default)
+//! ENGRAVING_BENCHMARKS_REPEATS - how many times every score is measured (3 by default)
+
+static const std::vector<std::string> METRICS = { "layout", "relayout", "spacing", "paint", "read", "write" };
+
+class Engraving_LayoutBenchmarks : public ::testing::Test
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Times = std::map<std::string, std::vector<double> >;
+
+    static std::string env(const char* name, const std::string& def)
+    {
+        const char* val = std::getenv(name);
+        return val && *val ? std::string(val) : def;
+    }
+
+    static double msSince(const Clock::time_point& start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static double median(std::vector<double> times)
+    {
+        if (times.empty()) {
+            return 0.0;
+        }
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+
+    static double percentile(const std::vector<double>& sorted, double p)
+    {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        size_t idx = std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()));
+        return sorted[idx];
+    }
+
+    static MasterScore* readScore(const io::path_t& path)
+    {
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+        ScoreLoad sl;
+        if (compat::loadMsczOrMscx(score, path.toString(), true) != Err::NoError) {
+            delete score;
+            return nullptr;
+        }
+
+        return score;
+    }
+
+    static Note* firstNote(Score* score)
+    {
+        for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+            for (EngravingItem* e : s->elist()) {
+                if (e && e->isChord()) {
+                    return toChord(e)->upNote();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    static double relayoutAfterNoteEdit(Score* score, Note* note)
+    {
+        const Measure* measure = note->chord()->measure();
+        const int pitch = note->pitch();
+        const int tpc1 = note->tpc1();
+        const int tpc2 = note->tpc2();
+
+        note->setPitch(pitch < 127 ? pitch + 1 : pitch - 1);
+
+        Clock::time_point start = Clock::now();
+        score->doLayoutRange(measure->tick(), measure->endTick());
+        double time = msSince(start);
+
+        note->setPitch(pitch, tpc1, tpc2);
+        score->doLayoutRange(measure->tick(), measure->endTick());
+
+        return time;
+    }
+
+    static double spacing(Score* score)
+    {
+        Clock::time_point start = Clock::now();
+        for (Segment* s = score->firstSegment(SegmentType::All); s; s = s->next1()) {
+            Segment* next = s->next();
+            if (!next) {
+                continue;
+            }
+            for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+                s->staffShape(staffIdx).minHorizontalDistance(next->staffShape(staffIdx), score);
+            }
+        }
+        return msSince(start);
+    }
+
+    static double paintPages(Score* score)
+    {
+        draw::IPaintProviderPtr provider = std::make_shared<NullPaintProvider>();
+
+        Clock::time_point start = Clock::now();
+        for (Page* page : score->pages()) {
+            draw::Painter painter(provider, "benchmark");
+            Paint::paintElements(painter, page->elements(), true);
+        }
+        return msSince(start);
+    }
+
+    static double writeScore(Score* score)
+    {
+        io::Buffer buffer;
+        buffer.open(io::IODevice::WriteOnly);
+
+        compat::WriteScoreHook hook;
+
+        Clock::time_point start = Clock::now();
+        score->writeScore(&buffer, false, false, hook);
+        return msSince(start);
+    }
+
+    static JsonObject summary(std::vector<double> times)
+    {
+        std::sort(times.begin(), times.end());
+
+        double total = 0.0;
+        for (double time : times) {
+            total += time;
+        }
+
+        JsonObject obj;
+        obj.set("count", static_cast<int>(times.size()));
+        obj.set("total_ms", total);
+        obj.set("p50_ms", percentile(times, 0.5));
+        obj.set("p90_ms", percentile(times, 0.9));
+        obj.set("p99_ms", percentile(times, 0.99));
+        obj.set("max_ms", times.empty() ? 0.0 : times.back());
+        return obj;
+    }
+};
+
+TEST_F(Engraving_LayoutBenchmarks, Corpus)
+{
+    const io::path_t scoresDir = env("ENGRAVING_BENCHMARKS_SCORES", ENGRAVING_BENCHMARKS_SCORES_DIR);
+    const io::path_t outputPath = env("ENGRAVING_BENCHMARKS_OUTPUT", "engraving_benchmarks.json");
+    const int repeats = std::max(1, std::atoi(env("ENGRAVING_BENCHMARKS_REPEATS", "3").c_str()));
+
+    RetVal<io::paths_t> files = io::Dir::scanFiles(scoresDir, { "*.mscx", "*.mscz" }, io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+    ASSERT_FALSE(files.val.empty());
+
+    std::sort(files.val.begin(), files.val.end());
+
+    std::map<std::string, std::vector<double> > corpusTimes;
+    JsonArray scoresJson;
+
+    std::cout << std::setw(40) << std::left << "score" << std::right;
+    for (const std::string& metric : METRICS) {
+        std::cout << std::setw(12) << metric + ", ms";
+    }
+    std::cout << std::endl;
+
+    for (const io::path_t& path : files.val) {
+        Times times;
+        bool ok = true;
+
+        for (int i = 0; i < repeats && ok; ++i) {
+            Clock::time_point start = Clock::now();
+            std::unique_ptr<MasterScore> score(readScore(path));
+            times["read"].push_back(msSince(start));
+
+            if (!score) {
+                ok = false;
+                break;
+            }
+
+            start = Clock::now();
+            score->doLayout();
+            times["layout"].push_back(msSince(start));
+
+            if (Note* note = firstNote(score.get())) {
+                times["relayout"].push_back(relayoutAfterNoteEdit(score.get(), note));
+            }
+
+            times["spacing"].push_back(spacing(score.get()));
+            times["paint"].push_back(paintPages(score.get()));
+            times["write"].push_back(writeScore(score.get()));
+        }
+
+        if (!ok) {
+            LOGW() << "skipped, can't load score: " << path;
+            continue;
+        }
+
+        const std::string name = io::filename(path).toStdString();
+
+        JsonObject scoreJson;
+        scoreJson.set("name", name);
+
+        std::cout << std::setw(40) << std::left << name << std::right << std::fixed << std::setprecision(2);
+        for (const std::string& metric : METRICS) {
+            const std::vector<double>& metricTimes = times[metric];
+            if (metricTimes.empty()) {
+                std::cout << std::setw(12) << "-";
+                continue;
+            }
+
+            double time = median(metricTimes);
+            corpusTimes[metric].push_back(time);
+            scoreJson.set(metric + "_ms", time);
+            std::cout << std::setw(12) << time;
+        }
+        std::cout << std::endl;
+
+        scoresJson.append(scoreJson);
+    }
+
+    JsonObject summaryJson;
+    for (const std::string& metric : METRICS) {
+        summaryJson.set(metric, summary(corpusTimes[metric]));
+    }
+
+    JsonObject root;
+    root.set("repeats", repeats);
+    root.set("summary", summaryJson);
+    root.set("scores", scoresJson);
+
+    io::File file(outputPath);
+    ASSERT_TRUE(file.open(io::IODevice::WriteOnly));
+    file.write(JsonDocument(root).toJson());
+
+    std::cout << "results: " << outputPath << std::endl;
+}
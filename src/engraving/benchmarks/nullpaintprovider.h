@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_NULLPAINTPROVIDER_H
+#define MU_ENGRAVING_NULLPAINTPROVIDER_H
+
+#include <stack>
+
+#include "draw/ipaintprovider.h"
+
+namespace mu::engraving {
+//! NOTE Keeps the state of the painter but draws nothing,
+//! so painting a page measures only the engraving side of it
+class NullPaintProvider : public draw::IPaintProvider
+{
+public:
+    bool isActive() const override { return m_isActive; }
+    void beginTarget(const std::string&) override { m_isActive = true; }
+    void beforeEndTargetHook(draw::Painter*) override {}
+    bool endTarget(bool = false) override { m_isActive = false; return true; }
+    void beginObject(const std::string&, const PointF&) override {}
+    void endObject() override {}
+
+    void setAntialiasing(bool) override {}
+    void setCompositionMode(draw::CompositionMode) override {}
+
+    void setFont(const draw::Font& font) override { m_state.font = font; }
+    const draw::Font& font() const override { return m_state.font; }
+
+    void setPen(const draw::Pen& pen) override { m_state.pen = pen; }
+    void setNoPen() override { m_state.pen.setStyle(draw::PenStyle::NoPen); }
+    const draw::Pen& pen() const override { return m_state.pen; }
+
+    void setBrush(const draw::Brush& brush) override { m_state.brush = brush; }
+    const draw::Brush& brush() const override { return m_state.brush; }
+
+    void save() override { m_states.push(m_state); }
+    void restore() override
+    {
+        if (!m_states.empty()) {
+            m_state = m_states.top();
+            m_states.pop();
+        }
+    }
+
+    void setTransform(const draw::Transform& transform) override { m_state.transform = transform; }
+    const draw::Transform& transform() const override { return m_state.transform; }
+
+    void drawPath(const draw::PainterPath&) override {}
+    void drawPolygon(const PointF*, size_t, draw::PolygonMode) override {}
+
+    void drawText(const PointF&, const String&) override {}
+    void drawText(const RectF&, int, const String&) override {}
+    void drawTextWorkaround(const draw::Font&, const PointF&, const String&) override {}
+
+    void drawSymbol(const PointF&, char32_t) override {}
+
+    void drawPixmap(const PointF&, const draw::Pixmap&) override {}
+    void drawTiledPixmap(const RectF&, const draw::Pixmap&, const PointF& = PointF()) override {}
+
+#ifndef NO_QT_SUPPORT
+    void drawPixmap(const PointF&, const QPixmap&) override {}
+    void drawTiledPixmap(const RectF&, const QPixmap&, const PointF& = PointF()) override {}
+#endif
+
+    void setClipRect(const RectF&) override {}
+    void setClipping(bool) override {}
+
+private:
+    struct State {
+        draw::Font font;
+        draw::Pen pen;
+        draw::Brush brush;
+        draw::Transform transform;
+    };
+
+    bool m_isActive = false;
+    State m_state;
+    std::stack<State> m_states;
+};
+}
+
+#endif // MU_ENGRAVING_NULLPAINTPROVIDER_H
@@ -65,7 +65,8 @@ void WriteScoreHook::onWriteExcerpts302(Score* score, XmlWriter& xml, bool selec
         if (score->isMaster()) {
             if (!selectionOnly) {
                 MasterScore* mScore = static_cast<MasterScore*>(score);
-                for (const Excerpt* excerpt : mScore->excerpts()) {
+                for (Excerpt* excerpt : mScore->excerpts()) {
+                    excerpt->load();
                     if (excerpt->excerptScore() != score) {
                         excerpt->excerptScore()->write(xml, selectionOnly, *this); // recursion write
                     }
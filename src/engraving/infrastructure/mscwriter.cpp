@@ -29,6 +29,7 @@
 #include "io/fileinfo.h"
 #include "io/dir.h"
 #include "serialization/xmlstreamwriter.h"
+#include "serialization/zipreader.h"
 #include "serialization/zipwriter.h"
 #include "serialization/textstream.h"
 
@@ -45,6 +46,8 @@ MscWriter::MscWriter(const Params& params)
 
 MscWriter::~MscWriter()
 {
+    //! NOTE The deferred files that were never written are discarded
+    m_deferredPending = false;
     close();
 }
 
@@ -69,11 +72,20 @@ const MscWriter::Params& MscWriter::params() const
 
 bool MscWriter::open()
 {
+    if (m_params.deferred) {
+        m_deferredPending = true;
+        return true;
+    }
+
     return writer()->open(m_params.device, m_params.filePath);
 }
 
 void MscWriter::close()
 {
+    if (m_deferredPending) {
+        writeDeferred();
+    }
+
     if (m_writer) {
         writeMeta();
 
@@ -86,15 +98,48 @@ void MscWriter::close()
 
 bool MscWriter::isOpened() const
 {
+    if (m_deferredPending) {
+        return true;
+    }
+
     return m_writer ? m_writer->isOpened() : false;
 }
 
+bool MscWriter::writeDeferred()
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(m_deferredPending) {
+        return false;
+    }
+
+    m_deferredPending = false;
+    std::vector<DeferredFile> files = std::move(m_deferredFiles);
+    m_deferredFiles.clear();
+
+    if (!writer()->open(m_params.device, m_params.filePath)) {
+        return false;
+    }
+
+    bool ok = true;
+    for (const DeferredFile& file : files) {
+        if (!writer()->addFileData(file.fileName, file.data)) {
+            LOGE() << "failed write file: " << file.fileName;
+            ok = false;
+        }
+    }
+
+    close();
+
+    return ok;
+}
+
 MscWriter::IWriter* MscWriter::writer() const
 {
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipFileWriter();
+            m_writer = new ZipFileWriter(m_params.sourceFilePath);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -113,6 +158,12 @@ MscWriter::IWriter* MscWriter::writer() const
 
 bool MscWriter::addFileData(const String& fileName, const ByteArray& data)
 {
+    if (m_deferredPending) {
+        m_deferredFiles.push_back({ fileName, data });
+        m_meta.addFile(fileName);
+        return true;
+    }
+
     if (!writer()->addFileData(fileName, data)) {
         LOGE() << "failed write file: " << fileName;
         return false;
@@ -245,9 +296,25 @@ void MscWriter::Meta::addFile(const String& file)
 // Writers
 // =======================================================================
 
+//! NOTE The payloads of these formats are already compressed, deflating them again is only a waste of time
+static bool isCompressedFormat(const String& fileName)
+{
+    static const std::vector<std::string> COMPRESSED_SUFFIXES = {
+        "png", "jpg", "jpeg", "gif", "webp", "ogg", "mp3", "flac"
+    };
+
+    return mu::contains(COMPRESSED_SUFFIXES, io::suffix(fileName));
+}
+
+MscWriter::ZipFileWriter::ZipFileWriter(const io::path_t& sourceFilePath)
+    : m_sourceFilePath(sourceFilePath)
+{
+}
+
 MscWriter::ZipFileWriter::~ZipFileWriter()
 {
     delete m_zip;
+    delete m_sourceZip;
     if (m_selfDeviceOwner) {
         delete m_device;
     }
@@ -270,6 +337,11 @@ bool MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath
 
     m_zip = new ZipWriter(m_device);
 
+    bool overwritesSource = !device && m_sourceFilePath == filePath;
+    if (!m_sourceFilePath.empty() && !overwritesSource && File::exists(m_sourceFilePath)) {
+        m_sourceZip = new ZipReader(m_sourceFilePath);
+    }
+
     return true;
 }
 
@@ -279,6 +351,10 @@ void MscWriter::ZipFileWriter::close()
         m_zip->close();
     }
 
+    if (m_sourceZip) {
+        m_sourceZip->close();
+    }
+
     if (m_device) {
         m_device->close();
     }
@@ -295,7 +371,12 @@ bool MscWriter::ZipFileWriter::addFileData(const String& fileName, const ByteArr
         return false;
     }
 
-    m_zip->addFile(fileName.toStdString(), data);
+    std::string name = fileName.toStdString();
+    bool copied = m_sourceZip && m_zip->copyFile(*m_sourceZip, name, data);
+    if (!copied) {
+        m_zip->addFile(name, data, !isCompressedFormat(fileName));
+    }
+
     if (m_zip->hasError()) {
         LOGE() << "failed write files to zip";
         return false;
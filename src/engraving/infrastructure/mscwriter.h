@@ -28,6 +28,7 @@
 #include "mscio.h"
 
 namespace mu {
+class ZipReader;
 class ZipWriter;
 class TextStream;
 }
@@ -43,6 +44,14 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE The container the score was loaded from (optional, zip only).
+        //! The files that are unchanged since then are copied from it as they are stored there
+        io::path_t sourceFilePath;
+
+        //! NOTE If deferred, the write methods only collect the files in memory,
+        //! the container is opened and the files are compressed and written by writeDeferred()
+        bool deferred = false;
     };
 
     MscWriter() = default;
@@ -56,6 +65,9 @@ public:
     void close();
     bool isOpened() const;
 
+    //! NOTE Doesn't touch the score, so it may be called on another thread
+    bool writeDeferred();
+
     void writeStyleFile(const ByteArray& data);
     void writeScoreFile(const ByteArray& data);
     void addExcerptStyleFile(const String& name, const ByteArray& data);
@@ -80,6 +92,7 @@ private:
 
     struct ZipFileWriter : public IWriter
     {
+        ZipFileWriter(const io::path_t& sourceFilePath);
         ~ZipFileWriter() override;
         bool open(io::IODevice* device, const io::path_t& filePath) override;
         void close() override;
@@ -90,6 +103,8 @@ private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
         ZipWriter* m_zip = nullptr;
+        io::path_t m_sourceFilePath;
+        ZipReader* m_sourceZip = nullptr;
     };
 
     struct DirWriter : public IWriter
@@ -115,6 +130,11 @@ private:
         TextStream* m_stream = nullptr;
     };
 
+    struct DeferredFile {
+        String fileName;
+        ByteArray data;
+    };
+
     struct Meta {
         std::vector<String> files;
         bool isWritten = false;
@@ -135,6 +155,9 @@ private:
     Params m_params;
     mutable IWriter* m_writer = nullptr;
     Meta m_meta;
+
+    bool m_deferredPending = false;
+    std::vector<DeferredFile> m_deferredFiles;
 };
 }
 
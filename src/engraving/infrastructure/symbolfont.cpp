@@ -658,11 +658,13 @@ void SymbolFont::draw(SymId id, Painter* painter, const SizeF& mag, const PointF
         return;
     }
 
+    //! NOTE The font is copied, so that pages can be painted from several threads
+    Font font = m_font;
+    font.setPointSizeF(20.0 * MScore::pixelRatio);
+
     painter->save();
-    double size = 20.0 * MScore::pixelRatio;
-    m_font.setPointSizeF(size);
     painter->scale(mag.width(), mag.height());
-    painter->setFont(m_font);
+    painter->setFont(font);
     painter->drawSymbol(PointF(pos.x() / mag.width(), pos.y() / mag.height()), symCode(id));
     painter->restore();
 }
@@ -119,7 +119,7 @@ private:
 
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
-    mutable draw::Font m_font;
+    draw::Font m_font;
 
     String m_name;
     String m_family;
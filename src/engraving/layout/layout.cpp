@@ -76,6 +76,8 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     CmdStateLocker cmdStateLocker(m_score);
     LayoutContext ctx(m_score);
 
+    m_changedRect = RectF();
+
     Fraction stick(st);
     Fraction etick(et);
     assert(!(stick == Fraction(-1, 1) && etick == Fraction(-1, 1)));
@@ -144,6 +146,9 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         return;
     }
 
+    std::map<const System*, SystemPlace> oldPlaces;
+    const size_t oldPageCount = m_score->npages();
+
     if (!layoutAll && m->system()) {
         System* system = m->system();
         system_idx_t systemIndex = mu::indexOf(m_score->_systems, system);
@@ -155,6 +160,10 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         ctx.curSystem   = system;
         ctx.systemList  = mu::mid(m_score->_systems, systemIndex);
 
+        for (const System* s : ctx.systemList) {
+            oldPlaces[s] = { s->page(), s->pos() };
+        }
+
         if (systemIndex == 0) {
             ctx.nextMeasure = options.showVBox ? m_score->first() : m_score->firstMeasure();
         } else {
@@ -217,6 +226,57 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     ctx.curSystem = LayoutSystem::collectSystem(options, ctx, m_score);
 
     doLayout(options, ctx);
+
+    if (!oldPlaces.empty() && m_score->npages() == oldPageCount) {
+        m_changedRect = changedPagesRect(oldPlaces, ctx);
+    }
+}
+
+//---------------------------------------------------------
+//   changedPagesRect
+//    union of the pages whose systems were laid out again, moved or removed;
+//    elements can be placed anywhere on their page, so the granularity is a page
+//---------------------------------------------------------
+
+RectF Layout::changedPagesRect(const std::map<const System*, SystemPlace>& oldPlaces, const LayoutContext& lc) const
+{
+    // systems appended unchanged after the layout became stable
+    const std::set<System*> untouched(lc.systemList.begin(), lc.systemList.end());
+
+    std::set<const Page*> changedPages;
+    std::set<const System*> systems;
+    for (System* s : m_score->_systems) {
+        systems.insert(s);
+        if (mu::contains(untouched, s)) {
+            continue;
+        }
+
+        auto old = oldPlaces.find(s);
+        if (old != oldPlaces.end()) {
+            bool reused = lc.reusedSystems.find(s) != lc.reusedSystems.end();
+            if (reused && old->second.page == s->page() && old->second.pos == s->pos()) {
+                continue;
+            }
+            changedPages.insert(old->second.page);
+        }
+        changedPages.insert(s->page());
+    }
+
+    // removed systems
+    for (const auto& place : oldPlaces) {
+        if (!mu::contains(systems, place.first)) {
+            changedPages.insert(place.second.page);
+        }
+    }
+
+    RectF rect;
+    for (const Page* page : changedPages) {
+        if (page) {
+            rect.unite(page->canvasBoundingRect());
+        }
+    }
+
+    return rect;
 }
 
 void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
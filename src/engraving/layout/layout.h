@@ -22,10 +22,16 @@
 #ifndef MU_ENGRAVING_LAYOUT_H
 #define MU_ENGRAVING_LAYOUT_H
 
+#include <map>
+
+#include "draw/types/geometry.h"
+
 #include "layoutoptions.h"
 
 namespace mu::engraving {
+class Page;
 class Score;
+class System;
 
 class LayoutContext;
 class Layout
@@ -35,7 +41,15 @@ public:
 
     void doLayoutRange(const LayoutOptions& options, const Fraction&, const Fraction&);
 
+    //! NOTE Canvas area changed by the last range layout,
+    //! invalid if everything has to be repainted (full layout, page count changed, linear mode)
+    const RectF& changedRect() const { return m_changedRect; }
+
 private:
+    struct SystemPlace {
+        const Page* page = nullptr;
+        PointF pos;
+    };
 
     void layoutLinear(const LayoutOptions& options, LayoutContext& ctx);
     void layoutLinear(bool layoutAll, const LayoutOptions& options, LayoutContext& lc);
@@ -44,7 +58,10 @@ private:
 
     void doLayout(const LayoutOptions& options, LayoutContext& lc);
 
+    RectF changedPagesRect(const std::map<const System*, SystemPlace>& oldPlaces, const LayoutContext& lc) const;
+
     Score* m_score = nullptr;
+    RectF m_changedRect;
 };
 }
 
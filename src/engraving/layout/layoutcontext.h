@@ -22,6 +22,7 @@
 #ifndef MU_ENGRAVING_LAYOUTCONTEXT_H
 #define MU_ENGRAVING_LAYOUTCONTEXT_H
 
+#include <map>
 #include <vector>
 #include <set>
 
@@ -53,6 +54,7 @@ public:
     Fraction tick{ 0, 1 };
 
     std::vector<System*> systemList; // reusable systems
+    std::map<System*, std::vector<double> > reusedSystems; // systems taken unchanged, with the staff positions they were laid out for
     std::set<Spanner*> processedSpanners;
 
     System* prevSystem = nullptr; // used during page layout
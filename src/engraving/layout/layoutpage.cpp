@@ -53,6 +53,20 @@
 
 using namespace mu::engraving;
 
+//---------------------------------------------------------
+//   staffPositions
+//---------------------------------------------------------
+
+static std::vector<double> staffPositions(const System* system)
+{
+    std::vector<double> positions;
+    positions.reserve(system->staves().size());
+    for (const SysStaff* staff : system->staves()) {
+        positions.push_back(staff->y());
+    }
+    return positions;
+}
+
 //---------------------------------------------------------
 //   getNextPage
 //---------------------------------------------------------
@@ -197,6 +211,7 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
                 nextSystem = ctx.systemList.empty() ? 0 : mu::takeFirst(ctx.systemList);
                 if (nextSystem) {
                     ctx.score()->systems().push_back(nextSystem);
+                    ctx.reusedSystems[nextSystem] = staffPositions(nextSystem);
                 }
             }
         } else {
@@ -250,6 +265,18 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 
     Fraction stick = Fraction(-1, 1);
     for (System* s : ctx.page->systems()) {
+        // systems taken unchanged after the layout range was done keep
+        // their measures and cross-staff elements, unless the page layout
+        // (distributeStaves) moved their staves
+        auto reused = ctx.reusedSystems.find(s);
+        if (reused != ctx.reusedSystems.end()) {
+            if (reused->second == staffPositions(s)) {
+                continue;
+            }
+            // laid out again below, so it no longer counts as unchanged
+            ctx.reusedSystems.erase(reused);
+        }
+
         Score* currentScore = ctx.score();
         for (MeasureBase* mb : s->measures()) {
             if (!mb->isMeasure()) {
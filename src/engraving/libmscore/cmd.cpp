@@ -141,6 +141,7 @@ void CmdState::reset()
     _oneElement = true;
     _mb = nullptr;
     _oneMeasureBase = true;
+    _updateAllRequested = false;
     _locked = false;
 }
 
@@ -253,6 +254,9 @@ void CmdState::_setUpdateMode(UpdateMode m)
 
 void CmdState::setUpdateMode(UpdateMode m)
 {
+    if (m == UpdateMode::UpdateAll) {
+        _updateAllRequested = true;
+    }
     if (int(m) > int(_updateMode)) {
         _setUpdateMode(m);
     }
@@ -276,6 +280,12 @@ void Score::startCmd()
 
     MScore::setError(MsError::MS_NO_ERROR);
 
+    // the unloaded excerpts must be linked before the command changes the master score:
+    // the changes reach the other scores through the links and through scoreList(),
+    // which can't tell in advance which parts a command touches
+    // (the application loads them while it's idle, see MasterNotation::loadNextExcerpt)
+    masterScore()->loadExcerpts();
+
     cmdState().reset();
 
     // Start collecting low-level undo operations for a
@@ -417,6 +427,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
     TRACEFUNC;
 
     bool updateAll = false;
+    std::set<Score*> laidOutScores;
     {
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
@@ -428,6 +439,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
                     continue;
                 }
                 s->doLayoutRange(cs.startTick(), cs.endTick());
+                laidOutScores.insert(s);
             }
             updateAll = true;
         }
@@ -441,12 +453,27 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
     {
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
-        if (updateAll || cs.updateAll()) {
+        if (cs.updateAll() && (!updateAll || cs.updateAllRequested())) {
             for (Score* s : scoreList()) {
                 for (MuseScoreView* v : s->viewer) {
                     v->updateAll();
                 }
             }
+        } else if (updateAll) {
+            for (Score* s : scoreList()) {
+                RectF rect = mu::contains(laidOutScores, s) ? s->layoutChangedRect() : RectF();
+                if (rect.isValid() && s == this && _updateState.refresh.isValid()) {
+                    rect.unite(_updateState.refresh);
+                    _updateState.refresh = RectF();
+                }
+                for (MuseScoreView* v : s->viewer) {
+                    if (rect.isValid()) {
+                        v->layoutRangeChanged(rect);
+                    } else {
+                        v->updateAll();
+                    }
+                }
+            }
         } else if (cs.updateRange()) {
             // updateRange updates only current score
             double d = spatium() * .5;
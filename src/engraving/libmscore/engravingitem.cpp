@@ -2673,16 +2673,34 @@ void EngravingItem::doInitAccessible()
 
 #endif // ENGRAVING_NO_ACCESSIBILITY
 
+KerningClass EngravingItem::kerningClass() const
+{
+    KerningClass kerningClass;
+    kerningClass.track = track();
+    kerningClass.userSetKerning = _userSetKerning;
+    kerningClass.sameVoiceKerningLimited = sameVoiceKerningLimited();
+    kerningClass.neverKernable = neverKernable();
+    kerningClass.alwaysKernable = alwaysKernable();
+    return kerningClass;
+}
+
 KerningType EngravingItem::computeKerningType(const EngravingItem* nextItem) const
 {
-    if (_userSetKerning != KerningType::NOT_SET) {
-        return _userSetKerning;
+    return computeKerningType(kerningClass(), nextItem, nextItem->kerningClass());
+}
+
+KerningType EngravingItem::computeKerningType(const KerningClass& kerningClass, const EngravingItem* nextItem,
+                                              const KerningClass& nextKerningClass) const
+{
+    if (kerningClass.userSetKerning != KerningType::NOT_SET) {
+        return kerningClass.userSetKerning;
     }
-    if (sameVoiceKerningLimited() && nextItem->sameVoiceKerningLimited() && track() == nextItem->track()) {
+    if (kerningClass.sameVoiceKerningLimited && nextKerningClass.sameVoiceKerningLimited
+        && kerningClass.track == nextKerningClass.track) {
         return KerningType::NON_KERNING;
     }
-    if ((neverKernable() || nextItem->neverKernable())
-        && !(alwaysKernable() || nextItem->alwaysKernable())) {
+    if ((kerningClass.neverKernable || nextKerningClass.neverKernable)
+        && !(kerningClass.alwaysKernable || nextKerningClass.alwaysKernable)) {
         return KerningType::NON_KERNING;
     }
     return doComputeKerningType(nextItem);
@@ -105,17 +105,6 @@ enum class ElementFlag {
 typedef Flags<ElementFlag> ElementFlags;
 DECLARE_OPERATORS_FOR_FLAGS(ElementFlags)
 
-enum class KerningType
-{
-    KERNING,
-    NON_KERNING,
-    LIMITED_KERNING,
-    SAME_VOICE_LIMIT,
-    KERNING_UNTIL_ORIGIN,
-    ALLOW_COLLISION,
-    NOT_SET,
-};
-
 class EngravingItemList : public std::list<EngravingItem*>
 {
     OBJECT_ALLOCATOR(engraving, EngravingItemList)
@@ -178,7 +167,11 @@ public:
 
     virtual ~EngravingItem();
 
+    KerningClass kerningClass() const;
+
     KerningType computeKerningType(const EngravingItem* nextItem) const;
+    KerningType computeKerningType(const KerningClass& kerningClass, const EngravingItem* nextItem,
+                                   const KerningClass& nextKerningClass) const;
     virtual double computePadding(const EngravingItem* nextItem) const;
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
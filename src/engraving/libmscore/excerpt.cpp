@@ -67,9 +67,13 @@ using namespace mu;
 using namespace mu::engraving;
 
 Excerpt::Excerpt(const Excerpt& ex, bool copyPartScore)
-    : m_masterScore(ex.m_masterScore), m_name(ex.m_name), m_parts(ex.m_parts), m_tracksMapping(ex.m_tracksMapping)
+    : m_masterScore(ex.m_masterScore), m_name(ex.m_name)
 {
-    m_excerptScore = (copyPartScore && ex.m_excerptScore) ? ex.m_excerptScore->clone() : nullptr;
+    Score* sourceScore = copyPartScore ? ex.excerptScore() : nullptr;
+
+    m_parts = ex.m_parts;
+    m_tracksMapping = ex.m_tracksMapping;
+    m_excerptScore = sourceScore ? sourceScore->clone() : nullptr;
 
     if (m_excerptScore) {
         m_excerptScore->setExcerpt(this);
@@ -101,6 +105,75 @@ void Excerpt::setInitialPartId(const ID& id)
     m_initialPartId = id;
 }
 
+Score* Excerpt::excerptScore() const
+{
+    return m_excerptScore;
+}
+
+bool Excerpt::isLoaded() const
+{
+    return !m_loader;
+}
+
+void Excerpt::load()
+{
+    if (isLoaded()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    Loader loader = std::move(m_loader);
+    m_loader = nullptr;
+
+    loader(this);
+
+    m_deferredStyleData = ByteArray();
+    m_deferredScoreData = ByteArray();
+
+    if (!m_excerptScore) {
+        return;
+    }
+
+    m_masterScore->initParts(this);
+    m_masterScore->rebuildExcerptsMidiMapping();
+
+    m_excerptScore->setPlaylistDirty();
+    m_excerptScore->addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
+    m_excerptScore->setLayoutAll();
+}
+
+void Excerpt::setDeferred(const ByteArray& styleData, const ByteArray& scoreData, const Loader& loader)
+{
+    m_deferredStyleData = styleData;
+    m_deferredScoreData = scoreData;
+    m_loader = loader;
+}
+
+const ByteArray& Excerpt::deferredStyleData() const
+{
+    return m_deferredStyleData;
+}
+
+const ByteArray& Excerpt::deferredScoreData() const
+{
+    return m_deferredScoreData;
+}
+
+bool Excerpt::isOpen() const
+{
+    if (!isLoaded()) {
+        return m_deferredOpen;
+    }
+
+    return m_excerptScore ? m_excerptScore->isOpen() : false;
+}
+
+void Excerpt::setDeferredOpen(bool open)
+{
+    m_deferredOpen = open;
+}
+
 void Excerpt::setExcerptScore(Score* s)
 {
     m_excerptScore = s;
@@ -122,6 +195,10 @@ void Excerpt::setName(const String& name)
         return;
     }
 
+    //! NOTE The name is also written to the part score, so the unloaded excerpt is loaded to be renamed,
+    //! otherwise its raw data would be saved with the old name
+    load();
+
     m_name = name;
     writeNameToMetaTags();
     m_nameChanged.notify();
@@ -129,7 +206,7 @@ void Excerpt::setName(const String& name)
 
 void Excerpt::writeNameToMetaTags()
 {
-    if (Score* score = excerptScore()) {
+    if (Score* score = m_excerptScore) {
         if (Text* nameItem = score->getText(mu::engraving::TextStyleType::INSTRUMENT_EXCERPT)) {
             nameItem->setPlainText(m_name);
             score->setMetaTag(u"partName", m_name);
@@ -166,6 +243,8 @@ void Excerpt::removePart(const ID& id)
         return;
     }
 
+    load();
+
     excerptScore()->undoRemovePart(excerptScore()->parts().at(index));
 }
 
@@ -180,6 +259,11 @@ size_t Excerpt::nstaves() const
 
 bool Excerpt::isEmpty() const
 {
+    //! NOTE The excerpt read from a file gets its parts and measures from its data when it's loaded
+    if (!isLoaded()) {
+        return false;
+    }
+
     return excerptScore() ? excerptScore()->parts().empty() : true;
 }
 
@@ -23,8 +23,10 @@
 #ifndef MU_ENGRAVING_EXCERPT_H
 #define MU_ENGRAVING_EXCERPT_H
 
+#include <functional>
 #include <map>
 
+#include "types/bytearray.h"
 #include "types/fraction.h"
 #include "types/types.h"
 #include "types/string.h"
@@ -53,9 +55,23 @@ public:
     void setInitialPartId(const ID& id);
 
     MasterScore* masterScore() const { return m_masterScore; }
-    Score* excerptScore() const { return m_excerptScore; }
+    Score* excerptScore() const;
     void setExcerptScore(Score* s);
 
+    //! NOTE The excerpt read from a file may be kept unloaded until its score is needed:
+    //! the loader creates the score from the raw data when load() is called, until then excerptScore() is null
+    using Loader = std::function<void (Excerpt*)>;
+
+    bool isLoaded() const;
+    void load();
+    void setDeferred(const ByteArray& styleData, const ByteArray& scoreData, const Loader& loader);
+
+    const ByteArray& deferredStyleData() const;
+    const ByteArray& deferredScoreData() const;
+
+    bool isOpen() const;
+    void setDeferredOpen(bool open);
+
     const String& name() const;
     void setName(const String& name);
     async::Notification nameChanged() const;
@@ -101,6 +117,12 @@ private:
 
     MasterScore* m_masterScore = nullptr;
     Score* m_excerptScore = nullptr;
+
+    Loader m_loader;
+    ByteArray m_deferredStyleData;
+    ByteArray m_deferredScoreData;
+    bool m_deferredOpen = false;
+
     String m_name;
     async::Notification m_nameChanged;
     std::vector<Part*> m_parts;
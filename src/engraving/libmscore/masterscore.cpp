@@ -254,6 +254,15 @@ bool MasterScore::writeMscz(MscWriter& mscWriter, bool onlySelection, bool doCre
     {
         if (!onlySelection) {
             for (const Excerpt* excerpt : this->excerpts()) {
+                //! NOTE The master score can't have been edited and the excerpt can't have been renamed
+                //! while the excerpt is unloaded (see Score::startCmd and Excerpt::setName),
+                //! so its data is still valid and can be written as is
+                if (!excerpt->isLoaded()) {
+                    mscWriter.addExcerptStyleFile(excerpt->name(), excerpt->deferredStyleData());
+                    mscWriter.addExcerptFile(excerpt->name(), excerpt->deferredScoreData());
+                    continue;
+                }
+
                 Score* partScore = excerpt->excerptScore();
                 if (partScore != this) {
                     // Write excerpt style
@@ -374,7 +383,8 @@ bool MasterScore::exportPart(MscWriter& mscWriter, Score* partScore)
 
 void MasterScore::addExcerpt(Excerpt* ex, size_t index)
 {
-    if (!ex->inited()) {
+    //! NOTE The parts of the unloaded excerpt are initialized when it's loaded
+    if (!ex->inited() && ex->isLoaded()) {
         initParts(ex);
     }
 
@@ -382,6 +392,19 @@ void MasterScore::addExcerpt(Excerpt* ex, size_t index)
     setExcerptsChanged(true);
 }
 
+//---------------------------------------------------------
+//   loadExcerpts
+//    the unloaded excerpts don't receive the changes of the master score,
+//    so they must be loaded before the master score is edited
+//---------------------------------------------------------
+
+void MasterScore::loadExcerpts()
+{
+    for (Excerpt* ex : excerpts()) {
+        ex->load();
+    }
+}
+
 //---------------------------------------------------------
 //   removeExcerpt
 //---------------------------------------------------------
@@ -122,6 +122,7 @@ class MasterScore : public Score
     int updateMidiMapping();
 
     friend class EngravingProject;
+    friend class Excerpt;
     friend class compat::ScoreAccess;
     friend class compat::Read114;
     friend class compat::Read206;
@@ -211,6 +212,7 @@ public:
     void setPos(POS pos, Fraction tick);
 
     void addExcerpt(Excerpt*, size_t index = mu::nidx);
+    void loadExcerpts();
     void removeExcerpt(Excerpt*);
     void deleteExcerpt(Excerpt*);
 
@@ -152,6 +152,10 @@ int MasterScore::getNextFreeDrumMidiMapping()
 void MasterScore::rebuildExcerptsMidiMapping()
 {
     for (Excerpt* ex : excerpts()) {
+        if (!ex->isLoaded()) {
+            continue;
+        }
+
         for (Part* p : ex->excerptScore()->parts()) {
             const Part* masterPart = p->masterPart();
             if (!masterPart->score()->isMaster()) {
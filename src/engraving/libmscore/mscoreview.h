@@ -46,6 +46,8 @@ public:
     virtual void layoutChanged() {}
     virtual void dataChanged(const mu::RectF&) = 0;
     virtual void updateAll() = 0;
+    //! NOTE Called after a range layout with the area it has changed
+    virtual void layoutRangeChanged(const mu::RectF&) { updateAll(); }
 
     virtual void moveCursor() {}
 
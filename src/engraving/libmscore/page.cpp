@@ -99,44 +99,51 @@ void Page::draw(mu::draw::Painter* painter) const
     // draw header/footer
     //
 
-    page_idx_t n = no() + 1 + score()->pageNumberOffset();
     painter->setPen(curColor());
 
-    String s1, s2, s3;
+    const std::array<String, MAX_HEADERS + MAX_FOOTERS> texts = headerFooterStyleTexts();
+    for (int area = 0; area < MAX_HEADERS + MAX_FOOTERS; ++area) {
+        drawHeaderFooter(painter, area, texts[area]);
+    }
+}
+
+//---------------------------------------------------------
+//   headerFooterStyleTexts
+//    header areas 0 1 2, footer areas 3 4 5
+//---------------------------------------------------------
+
+std::array<String, MAX_HEADERS + MAX_FOOTERS> Page::headerFooterStyleTexts() const
+{
+    std::array<String, MAX_HEADERS + MAX_FOOTERS> texts;
+    page_idx_t n = no() + 1 + score()->pageNumberOffset();
 
     if (score()->styleB(Sid::showHeader) && (no() || score()->styleB(Sid::headerFirstPage))) {
         bool odd = (n & 1) || !score()->styleB(Sid::headerOddEven);
         if (odd) {
-            s1 = score()->styleSt(Sid::oddHeaderL);
-            s2 = score()->styleSt(Sid::oddHeaderC);
-            s3 = score()->styleSt(Sid::oddHeaderR);
+            texts[0] = score()->styleSt(Sid::oddHeaderL);
+            texts[1] = score()->styleSt(Sid::oddHeaderC);
+            texts[2] = score()->styleSt(Sid::oddHeaderR);
         } else {
-            s1 = score()->styleSt(Sid::evenHeaderL);
-            s2 = score()->styleSt(Sid::evenHeaderC);
-            s3 = score()->styleSt(Sid::evenHeaderR);
+            texts[0] = score()->styleSt(Sid::evenHeaderL);
+            texts[1] = score()->styleSt(Sid::evenHeaderC);
+            texts[2] = score()->styleSt(Sid::evenHeaderR);
         }
-
-        drawHeaderFooter(painter, 0, s1);
-        drawHeaderFooter(painter, 1, s2);
-        drawHeaderFooter(painter, 2, s3);
     }
 
     if (score()->styleB(Sid::showFooter) && (no() || score()->styleB(Sid::footerFirstPage))) {
         bool odd = (n & 1) || !score()->styleB(Sid::footerOddEven);
         if (odd) {
-            s1 = score()->styleSt(Sid::oddFooterL);
-            s2 = score()->styleSt(Sid::oddFooterC);
-            s3 = score()->styleSt(Sid::oddFooterR);
+            texts[3] = score()->styleSt(Sid::oddFooterL);
+            texts[4] = score()->styleSt(Sid::oddFooterC);
+            texts[5] = score()->styleSt(Sid::oddFooterR);
         } else {
-            s1 = score()->styleSt(Sid::evenFooterL);
-            s2 = score()->styleSt(Sid::evenFooterC);
-            s3 = score()->styleSt(Sid::evenFooterR);
+            texts[3] = score()->styleSt(Sid::evenFooterL);
+            texts[4] = score()->styleSt(Sid::evenFooterC);
+            texts[5] = score()->styleSt(Sid::evenFooterR);
         }
-
-        drawHeaderFooter(painter, 3, s1);
-        drawHeaderFooter(painter, 4, s2);
-        drawHeaderFooter(painter, 5, s3);
     }
+
+    return texts;
 }
 
 //---------------------------------------------------------
@@ -145,6 +152,16 @@ void Page::draw(mu::draw::Painter* painter) const
 
 void Page::drawHeaderFooter(mu::draw::Painter* p, int area, const String& ss) const
 {
+    if (!_headerFooterCopies.empty()) {
+        const Text* copy = _headerFooterCopies.at(area).get();
+        if (copy) {
+            p->translate(copy->pos());
+            copy->draw(p);
+            p->translate(-copy->pos());
+        }
+        return;
+    }
+
     Text* text = layoutHeaderFooter(area, ss);
     if (!text) {
         return;
@@ -155,6 +172,38 @@ void Page::drawHeaderFooter(mu::draw::Painter* p, int area, const String& ss) co
     text->resetExplicitParent();
 }
 
+//---------------------------------------------------------
+//   layoutHeaderFooterCopies
+//---------------------------------------------------------
+
+void Page::layoutHeaderFooterCopies()
+{
+    clearHeaderFooterCopies();
+
+    const std::array<String, MAX_HEADERS + MAX_FOOTERS> texts = headerFooterStyleTexts();
+    std::vector<std::shared_ptr<Text> > copies(texts.size());
+
+    for (int area = 0; area < MAX_HEADERS + MAX_FOOTERS; ++area) {
+        Text* text = layoutHeaderFooter(area, texts[area]);
+        if (!text) {
+            continue;
+        }
+        copies[area].reset(text->clone());
+        text->resetExplicitParent();
+    }
+
+    _headerFooterCopies = std::move(copies);
+}
+
+//---------------------------------------------------------
+//   clearHeaderFooterCopies
+//---------------------------------------------------------
+
+void Page::clearHeaderFooterCopies()
+{
+    _headerFooterCopies.clear();
+}
+
 //---------------------------------------------------------
 //   layoutHeaderFooter
 //---------------------------------------------------------
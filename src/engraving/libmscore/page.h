@@ -23,10 +23,13 @@
 #ifndef __PAGE_H__
 #define __PAGE_H__
 
+#include <array>
+#include <memory>
 #include <vector>
 
 #include "engravingitem.h"
 #include "bsp.h"
+#include "mscore.h"
 
 namespace mu::engraving {
 class RootItem;
@@ -53,12 +56,15 @@ class Page final : public EngravingItem
     BspTree bspTree;
     bool bspTreeValid;
 
+    std::vector<std::shared_ptr<Text> > _headerFooterCopies;
+
     void doRebuildBspTree();
 
     friend class Factory;
     Page(RootItem* parent);
 
     String replaceTextMacros(const String&) const;
+    std::array<String, MAX_HEADERS + MAX_FOOTERS> headerFooterStyleTexts() const;
     void drawHeaderFooter(mu::draw::Painter*, int area, const String&) const;
     Text* layoutHeaderFooter(int area, const String& ss) const;
 
@@ -87,6 +93,11 @@ public:
     double headerExtension() const;
     double footerExtension() const;
 
+    //! NOTE The header and footer texts are shared by all pages of the score and are laid out while a page is drawn.
+    //! To draw several pages at the same time, lay them out for every page into its own copies beforehand
+    void layoutHeaderFooterCopies();
+    void clearHeaderFooterCopies();
+
     void draw(mu::draw::Painter*) const override;
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
@@ -4326,7 +4326,8 @@ std::list<Score*> Score::scoreList()
     MasterScore* root = masterScore();
     scores.push_back(root);
     for (const Excerpt* ex : root->excerpts()) {
-        if (ex->excerptScore()) {
+        // the unloaded excerpts are loaded on demand, see MasterScore::loadExcerpts()
+        if (ex->isLoaded() && ex->excerptScore()) {
             scores.push_back(ex->excerptScore());
         }
     }
@@ -265,6 +265,7 @@ class CmdState
     const MeasureBase* _mb = nullptr;
     bool _oneElement = true;
     bool _oneMeasureBase = true;
+    bool _updateAllRequested = false;        // UpdateAll was requested, also if the mode is Layout
 
     bool _locked = false;
 
@@ -283,6 +284,7 @@ public:
     bool layoutRange() const { return _updateMode == UpdateMode::Layout; }
     bool updateAll() const { return int(_updateMode) >= int(UpdateMode::UpdateAll); }
     bool updateRange() const { return _updateMode == UpdateMode::Update; }
+    bool updateAllRequested() const { return _updateAllRequested; }
     void setTick(const Fraction& t);
     void setStaff(staff_idx_t staff);
     void setElement(const EngravingItem* e);
@@ -1044,6 +1046,7 @@ public:
 
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
+    const mu::RectF& layoutChangedRect() const { return m_layout.changedRect(); }
 
     SynthesizerState& synthesizerState() { return _synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
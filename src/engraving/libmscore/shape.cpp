@@ -22,6 +22,7 @@
 
 #include "shape.h"
 
+#include "engravingitem.h"
 #include "score.h"
 
 #include "draw/painter.h"
@@ -32,6 +33,14 @@ using namespace mu;
 using namespace mu::draw;
 
 namespace mu::engraving {
+ShapeElement::ShapeElement(const RectF& f, const EngravingItem* p)
+    : RectF(f), toItem(p)
+{
+    if (toItem) {
+        kerningClass = toItem->kerningClass();
+    }
+}
+
 //---------------------------------------------------------
 //   addHorizontalSpacing
 //    This methods creates "walls". They are represented by
@@ -100,26 +109,34 @@ Shape Shape::translated(const PointF& pt) const
 double Shape::minHorizontalDistance(const Shape& a, Score* score) const
 {
     double dist = -1000000.0;        // min real
+    if (empty() || a.empty()) {
+        return dist;
+    }
+
     double verticalClearance = 0.2 * score->spatium();
+
+    //! NOTE The kerning classes are stored in the shape elements, so for most pairs
+    //! the kerning is computed without virtual calls.
+    //! The padding is computed only for the pairs that collide
     for (const ShapeElement& r2 : a) {
         const EngravingItem* item2 = r2.toItem;
         double by1 = r2.top();
         double by2 = r2.bottom();
+        bool isLyrics2 = item2 && item2->isLyrics();
         for (const ShapeElement& r1 : *this) {
             const EngravingItem* item1 = r1.toItem;
             double ay1 = r1.top();
             double ay2 = r1.bottom();
             bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
-            double padding = 0;
             KerningType kerningType = KerningType::NON_KERNING;
             if (item1 && item2) {
-                padding = item1->computePadding(item2);
-                kerningType = item1->computeKerningType(item2);
+                kerningType = item1->computeKerningType(r1.kerningClass, item2, r2.kerningClass);
             }
             if ((intersection && kerningType != KerningType::ALLOW_COLLISION)
                 || (r1.width() == 0 || r2.width() == 0) // Temporary hack: shapes of zero-width are assumed to collide with everyghin
-                || (!item1 && item2 && item2->isLyrics()) // Temporary hack: avoids collision with melisma line
+                || (!item1 && isLyrics2) // Temporary hack: avoids collision with melisma line
                 || kerningType == KerningType::NON_KERNING) {
+                double padding = (item1 && item2) ? item1->computePadding(item2) : 0.0;
                 dist = std::max(dist, r1.right() - r2.left() + padding);
             }
             if (kerningType == KerningType::KERNING_UNTIL_ORIGIN) { //prepared for future user option, for now always false
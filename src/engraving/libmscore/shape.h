@@ -26,6 +26,8 @@
 #include "global/allocator.h"
 #include "draw/types/geometry.h"
 
+#include "types/types.h"
+
 namespace mu::draw {
 class Painter;
 }
@@ -34,6 +36,27 @@ namespace mu::engraving {
 class EngravingItem;
 class Score;
 
+enum class KerningType
+{
+    KERNING,
+    NON_KERNING,
+    LIMITED_KERNING,
+    SAME_VOICE_LIMIT,
+    KERNING_UNTIL_ORIGIN,
+    ALLOW_COLLISION,
+    NOT_SET,
+};
+
+//! NOTE The data of the item that EngravingItem::computeKerningType() needs for every next item,
+//! taken once when the item is added to a shape, so Shape::minHorizontalDistance needs no virtual calls for it
+struct KerningClass {
+    track_idx_t track = mu::nidx;
+    KerningType userSetKerning = KerningType::NOT_SET;
+    bool sameVoiceKerningLimited = false;
+    bool neverKernable = false;
+    bool alwaysKernable = false;
+};
+
 //---------------------------------------------------------
 //   ShapeElement
 //---------------------------------------------------------
@@ -42,8 +65,8 @@ struct ShapeElement : public mu::RectF {
     OBJECT_ALLOCATOR(engraving, ShapeElement)
 public:
     const EngravingItem* toItem = nullptr;
-    ShapeElement(const mu::RectF& f, const EngravingItem* p)
-        : mu::RectF(f), toItem(p) {}
+    KerningClass kerningClass;
+    ShapeElement(const mu::RectF& f, const EngravingItem* p);
     ShapeElement(const mu::RectF& f)
         : mu::RectF(f) {}
 #ifndef NDEBUG
@@ -112,9 +112,41 @@ SkylineLine::SegConstIter SkylineLine::find(double x) const
 
 void SkylineLine::add(const Shape& s)
 {
-    for (const auto& r : s) {
-        add(r);
+    if (s.size() < 2) {
+        for (const auto& r : s) {
+            add(r);
+        }
+        return;
+    }
+
+    //! NOTE Adding the elements one by one to seg moves its tail for every inserted segment.
+    //! An element changes only the segments over its x range, so the elements are added
+    //! to a copy of the segments over the x range of the whole shape, which then replaces them in seg.
+    //! The result is the same as adding to seg (including the staff spans), the tail is moved once at most
+    double left = s.front().x();
+    double right = s.front().x() + s.front().width();
+    for (const ShapeElement& r : s) {
+        left = std::min(left, r.x());
+        right = std::max(right, r.x() + r.width());
+    }
+
+    SegIter b = find(std::max(left, 0.0));
+    SegIter e = std::upper_bound(b, seg.end(), right, [](double x, const SkylineSegment& segment) { return x < segment.x; });
+    if (e != seg.end()) {
+        ++e; // insert() may move the start of the next segment
     }
+
+    SkylineLine sl(north);
+    sl.seg.reserve(std::distance(b, e) + 2 * s.size());
+    sl.seg.assign(b, e);
+    for (const ShapeElement& r : s) {
+        sl.add(r);
+    }
+
+    // add() only splits and appends segments, so the copy has at least as many segments as it had
+    const size_t count = std::distance(b, e);
+    SegIter out = std::copy(sl.seg.begin(), sl.seg.begin() + count, b);
+    seg.insert(out, sl.seg.begin() + count, sl.seg.end());
 }
 
 void SkylineLine::add(const ShapeElement& r)
@@ -129,9 +161,8 @@ void SkylineLine::add(const ShapeElement& r)
 
 void Skyline::add(const Shape& s)
 {
-    for (const auto& r : s) {
-        add(r);
-    }
+    _north.add(s);
+    _south.add(s);
 }
 
 void SkylineLine::add(double x, double y, double w, int span)
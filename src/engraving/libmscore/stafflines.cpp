@@ -196,6 +196,22 @@ void StaffLines::draw(mu::draw::Painter* painter) const
     painter->drawLines(lines);
 }
 
+//---------------------------------------------------------
+//   drawStretched
+//---------------------------------------------------------
+
+void StaffLines::drawStretched(mu::draw::Painter* painter, double right) const
+{
+    TRACE_OBJ_DRAW;
+    using namespace mu::draw;
+    std::vector<mu::LineF> stretched = lines;
+    for (mu::LineF& line : stretched) {
+        line.setP2(mu::PointF(right, line.p2().y()));
+    }
+    painter->setPen(Pen(curColor(), lw, PenStyle::SolidLine, PenCapStyle::FlatCap));
+    painter->drawLines(stretched);
+}
+
 //---------------------------------------------------------
 //   y1
 //---------------------------------------------------------
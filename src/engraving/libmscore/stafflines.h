@@ -50,6 +50,7 @@ public:
 
     void layout() override;
     void draw(mu::draw::Painter*) const override;
+    void drawStretched(mu::draw::Painter* painter, double right) const; ///< draw the lines up to x = right
     mu::PointF pagePos() const override;      ///< position in page coordinates
     mu::PointF canvasPos() const override;    ///< position in page coordinates
 
@@ -22,6 +22,9 @@
 
 #include "playbackmodel.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "libmscore/fret.h"
 #include "libmscore/instrument.h"
 #include "libmscore/measure.h"
@@ -32,6 +35,9 @@
 #include "libmscore/tempo.h"
 #include "libmscore/measurerepeat.h"
 
+#include "utils/arrangementutils.h"
+
+#include "async/async.h"
 #include "log.h"
 
 using namespace mu;
@@ -55,6 +61,36 @@ static const Harmony* findChordSymbol(const EngravingItem* item)
     return nullptr;
 }
 
+static PlaybackEvent shiftedEvent(const PlaybackEvent& event, const timestamp_t timestampOffset)
+{
+    if (timestampOffset == 0) {
+        return event;
+    }
+
+    if (std::holds_alternative<RestEvent>(event)) {
+        ArrangementContext arrangementCtx = std::get<RestEvent>(event).arrangementCtx();
+        arrangementCtx.nominalTimestamp += timestampOffset;
+        arrangementCtx.actualTimestamp += timestampOffset;
+
+        return RestEvent(std::move(arrangementCtx));
+    }
+
+    const NoteEvent& noteEvent = std::get<NoteEvent>(event);
+
+    ArrangementContext arrangementCtx = noteEvent.arrangementCtx();
+    arrangementCtx.nominalTimestamp += timestampOffset;
+    arrangementCtx.actualTimestamp += timestampOffset;
+
+    PitchContext pitchCtx = noteEvent.pitchCtx();
+
+    ExpressionContext expressionCtx = noteEvent.expressionCtx();
+    for (auto& pair : expressionCtx.articulations) {
+        pair.second.meta.timestamp += timestampOffset;
+    }
+
+    return NoteEvent(std::move(arrangementCtx), std::move(pitchCtx), std::move(expressionCtx));
+}
+
 void PlaybackModel::load(Score* score)
 {
     if (!score || score->measures()->empty() || !score->lastMeasure()) {
@@ -67,6 +103,8 @@ void PlaybackModel::load(Score* score)
     changesChannel.resetOnReceive(this);
 
     changesChannel.onReceive(this, [this](const ScoreChangesRange& range) {
+        finishIncrementalLoad();
+
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
@@ -86,7 +124,21 @@ void PlaybackModel::load(Score* score)
         reload();
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    m_incrementalLoadTick = -1;
+
+    if (m_incrementalLoad) {
+        updateSetupData();
+        updateContext(0, m_score->ntracks());
+
+        m_incrementalLoadTick = 0;
+        m_incrementalChunkMeasures = 1;
+        m_incrementalLoadedMeasures = 0;
+        m_incrementalNotifiedMeasures = 0;
+
+        loadNextChunk(true /*isTimeLimited*/);
+    } else {
+        update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    }
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
@@ -97,6 +149,9 @@ void PlaybackModel::load(Score* score)
 
 void PlaybackModel::reload()
 {
+    //! NOTE Everything is rendered again below
+    m_incrementalLoadTick = -1;
+
     int trackFrom = 0;
     size_t trackTo = m_score->ntracks();
 
@@ -144,6 +199,17 @@ void PlaybackModel::setPlayChordSymbols(const bool isEnabled)
     m_playChordSymbols = isEnabled;
 }
 
+bool PlaybackModel::isIncrementalLoadEnabled() const
+{
+    return m_incrementalLoad;
+}
+
+void PlaybackModel::setIncrementalLoad(const bool isEnabled, const std::chrono::milliseconds chunkDuration)
+{
+    m_incrementalLoad = isEnabled;
+    m_incrementalChunkDuration = chunkDuration;
+}
+
 const InstrumentTrackId& PlaybackModel::metronomeTrackId() const
 {
     return METRONOME_TRACK_ID;
@@ -174,6 +240,8 @@ const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const InstrumentTrac
         return empty;
     }
 
+    finishIncrementalLoad();
+
     update(0, m_score->lastMeasure()->tick().ticks(), part->startTrack(), part->endTrack());
 
     return m_playbackDataMap[trackId];
@@ -270,6 +338,81 @@ void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx
     updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
 }
 
+void PlaybackModel::loadNextChunk(const bool isTimeLimited)
+{
+    TRACEFUNC;
+
+    if (isIncrementalLoadFinished()) {
+        return;
+    }
+
+    const Measure* firstMeasure = m_score->tick2measure(Fraction::fromTicks(m_incrementalLoadTick));
+    const Measure* lastMeasure = firstMeasure;
+    size_t chunkMeasures = 1;
+
+    //! NOTE Every call of updateEvents walks through the whole repeat list,
+    //!      so the whole chunk is rendered as one range
+    while (lastMeasure->nextMeasure() && (!isTimeLimited || chunkMeasures < m_incrementalChunkMeasures)) {
+        lastMeasure = lastMeasure->nextMeasure();
+        chunkMeasures++;
+    }
+
+    auto chunkStart = std::chrono::steady_clock::now();
+
+    updateEvents(firstMeasure->tick().ticks(), lastMeasure->endTick().ticks() - 1, 0, m_score->ntracks());
+
+    m_incrementalLoadedMeasures += chunkMeasures;
+    m_incrementalLoadTick = lastMeasure->nextMeasure() ? lastMeasure->endTick().ticks() : -1;
+
+    //! NOTE The next chunk gets as many measures as fit into the chunk duration at the speed of this one,
+    //!      but at most twice as many, since the measures differ in their content
+    if (isTimeLimited) {
+        auto elapsed = std::chrono::steady_clock::now() - chunkStart;
+        int64_t chunkDuration = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        int64_t maxDuration = std::chrono::duration_cast<std::chrono::microseconds>(m_incrementalChunkDuration).count();
+        int64_t fittingMeasures = static_cast<int64_t>(chunkMeasures) * maxDuration / std::max(chunkDuration, int64_t(1));
+
+        m_incrementalChunkMeasures = static_cast<size_t>(std::clamp(fittingMeasures, int64_t(1), static_cast<int64_t>(chunkMeasures) * 2));
+    }
+
+    //! NOTE The sequencers receive the whole events map on every notification,
+    //!      so notify only when the amount of loaded measures has doubled, and at the end
+    bool isFinished = isIncrementalLoadFinished();
+    if (isFinished || m_incrementalLoadedMeasures >= m_incrementalNotifiedMeasures * 2) {
+        notifyAboutLoadedEvents();
+    }
+
+    if (isFinished) {
+        m_dataChanged.notify();
+        return;
+    }
+
+    async::Async::call(this, [this]() {
+        loadNextChunk(true /*isTimeLimited*/);
+    });
+}
+
+void PlaybackModel::finishIncrementalLoad()
+{
+    if (!isIncrementalLoadFinished()) {
+        loadNextChunk(false /*isTimeLimited*/);
+    }
+}
+
+bool PlaybackModel::isIncrementalLoadFinished() const
+{
+    return m_incrementalLoadTick < 0;
+}
+
+void PlaybackModel::notifyAboutLoadedEvents()
+{
+    for (auto& pair : m_playbackDataMap) {
+        pair.second.mainStream.send(pair.second.originEvents);
+    }
+
+    m_incrementalNotifiedMeasures = m_incrementalLoadedMeasures;
+}
+
 void PlaybackModel::updateSetupData()
 {
     for (const Part* part : m_score->parts()) {
@@ -318,8 +461,29 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
     trackData.dynamicLevelMap = ctx.dynamicLevelMap(m_score);
 }
 
-void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
-                                   ChangedTrackIdSet* trackChanges)
+void PlaybackModel::renderMeasure(const int tickPositionOffset, const Measure* measure, const staff_idx_t staffIdx, const int tickFrom,
+                                  const int tickTo, RenderedMeasureEvents& result)
+{
+    result.tickPositionOffset = tickPositionOffset;
+
+    for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType()) {
+            continue;
+        }
+
+        int segmentStartTick = segment->tick().ticks();
+        int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+
+        if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+            continue;
+        }
+
+        processSegment(tickPositionOffset, segment, staffIdx, result);
+    }
+}
+
+void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const staff_idx_t staffIdx,
+                                   RenderedMeasureEvents& result)
 {
     int segmentStartTick = segment->tick().ticks();
 
@@ -333,29 +497,25 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             continue;
         }
 
-        staff_idx_t staffIdx = item->staffIdx();
-        if (changedStaffIdSet.find(staffIdx) == changedStaffIdSet.cend()) {
+        if (item->staffIdx() != staffIdx) {
             continue;
         }
 
         InstrumentTrackId trackId = chordSymbolsTrackId(item->part()->id());
+        PlaybackEventsMap& events = result.events[trackId];
 
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset,
-                                         m_playbackDataMap[trackId].originEvents);
+            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, events);
         }
-
-        collectChangesTracks(trackId, trackChanges);
     }
 
-    for (const EngravingItem* item : segment->elist()) {
-        if (!item || !item->isChordRest() || !item->part()) {
-            continue;
-        }
+    track_idx_t trackFrom = staff2track(staffIdx);
+    track_idx_t trackTo = trackFrom + VOICES;
 
-        staff_idx_t staffIdx = item->staffIdx();
+    for (track_idx_t track = trackFrom; track < trackTo; ++track) {
+        const EngravingItem* item = segment->element(track);
 
-        if (changedStaffIdSet.find(staffIdx) == changedStaffIdSet.cend()) {
+        if (!item || !item->isChordRest() || !item->part()) {
             continue;
         }
 
@@ -379,7 +539,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             int repeatPositionTickOffset = currentMeasureTick - referringMeasureTick;
 
             for (Segment* segment = referringMeasure->first(); segment; segment = segment->next()) {
-                processSegment(tickPositionOffset + repeatPositionTickOffset, segment, { staffIdx }, trackChanges);
+                processSegment(tickPositionOffset + repeatPositionTickOffset, segment, staffIdx, result);
             }
         }
 
@@ -391,11 +551,77 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             continue;
         }
 
-        m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
-                          ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
+        RenderingInput input;
+        input.trackId = trackId;
+        input.positionTick = segmentStartTick + tickPositionOffset;
+        input.dynamicLevel = ctx.appliableDynamicLevel(input.positionTick);
+        input.persistentArticulation = ctx.persistentArticulationType(input.positionTick);
 
-        collectChangesTracks(trackId, trackChanges);
+        m_renderer.render(item, tickPositionOffset, input.dynamicLevel, input.persistentArticulation, std::move(profile),
+                          result.events[trackId]);
+
+        result.inputs.push_back(std::move(input));
+    }
+}
+
+bool PlaybackModel::canBeReplayed(const RenderedMeasureEvents& measureEvents, const int tickPositionOffset) const
+{
+    int positionTickDiff = tickPositionOffset - measureEvents.tickPositionOffset;
+
+    for (const RenderingInput& input : measureEvents.inputs) {
+        auto search = m_playbackCtxMap.find(input.trackId);
+        if (search == m_playbackCtxMap.cend()) {
+            return false;
+        }
+
+        const PlaybackContext& ctx = search->second;
+        int positionTick = input.positionTick + positionTickDiff;
+
+        if (ctx.appliableDynamicLevel(positionTick) != input.dynamicLevel
+            || ctx.persistentArticulationType(positionTick) != input.persistentArticulation) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void PlaybackModel::applyEvents(RenderedMeasureEvents&& measureEvents, ChangedTrackIdSet* trackChanges)
+{
+    for (auto& pair : measureEvents.events) {
+        PlaybackEventsMap& originEvents = m_playbackDataMap[pair.first].originEvents;
+
+        for (auto& events : pair.second) {
+            PlaybackEventList& originList = originEvents[events.first];
+
+            if (originList.empty()) {
+                originList = std::move(events.second);
+                continue;
+            }
+
+            originList.insert(originList.end(), std::make_move_iterator(events.second.begin()),
+                              std::make_move_iterator(events.second.end()));
+        }
+
+        collectChangesTracks(pair.first, trackChanges);
+    }
+}
+
+void PlaybackModel::applyEvents(const RenderedMeasureEvents& measureEvents, const mpe::timestamp_t timestampOffset,
+                                ChangedTrackIdSet* trackChanges)
+{
+    for (const auto& pair : measureEvents.events) {
+        PlaybackEventsMap& originEvents = m_playbackDataMap[pair.first].originEvents;
+
+        for (const auto& events : pair.second) {
+            PlaybackEventList& originList = originEvents[events.first + timestampOffset];
+
+            for (const PlaybackEvent& event : events.second) {
+                originList.push_back(shiftedEvent(event, timestampOffset));
+            }
+        }
+
+        collectChangesTracks(pair.first, trackChanges);
     }
 }
 
@@ -406,6 +632,22 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
 
     std::set<staff_idx_t> changedStaffIdSet = m_score->staffIdsFromRange(trackFrom, trackTo);
 
+    //! NOTE Measures played more than once (repeats, jumps) are rendered on the first pass only,
+    //!      the next passes reuse the rendered events shifted in time, as long as the dynamics
+    //!      and the playing techniques are the same as on the first pass
+    std::unordered_map<const Measure*, int> measurePassesCount;
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        for (const Measure* measure : repeatSegment->measureList()) {
+            if (measure->tick().ticks() > tickTo) {
+                break;
+            }
+
+            measurePassesCount[measure]++;
+        }
+    }
+
+    std::map<std::pair<const Measure*, staff_idx_t>, RenderedMeasureEvents> renderedMeasures;
+
     for (const RepeatSegment* repeatSegment : repeatList()) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         int repeatStartTick = repeatSegment->tick;
@@ -423,19 +665,30 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 continue;
             }
 
-            for (Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
+            bool isWholeMeasureInRange = measureStartTick >= tickFrom && measureEndTick - 1 <= tickTo;
+            bool isReplayable = isWholeMeasureInRange && measurePassesCount[measure] > 1;
+
+            for (staff_idx_t staffIdx : changedStaffIdSet) {
+                if (!isReplayable) {
+                    RenderedMeasureEvents measureEvents;
+                    renderMeasure(tickPositionOffset, measure, staffIdx, tickFrom, tickTo, measureEvents);
+                    applyEvents(std::move(measureEvents), trackChanges);
                     continue;
                 }
 
-                int segmentStartTick = segment->tick().ticks();
-                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+                RenderedMeasureEvents& measureEvents = renderedMeasures[{ measure, staffIdx }];
+
+                if (!measureEvents.events.empty() && canBeReplayed(measureEvents, tickPositionOffset)) {
+                    timestamp_t timestampOffset = timestampFromTicks(m_score, measureStartTick + tickPositionOffset)
+                                                  - timestampFromTicks(m_score, measureStartTick + measureEvents.tickPositionOffset);
 
-                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+                    applyEvents(measureEvents, timestampOffset, trackChanges);
                     continue;
                 }
 
-                processSegment(tickPositionOffset, segment, changedStaffIdSet, trackChanges);
+                measureEvents = RenderedMeasureEvents();
+                renderMeasure(tickPositionOffset, measure, staffIdx, tickFrom, tickTo, measureEvents);
+                applyEvents(measureEvents, 0, trackChanges);
             }
 
             m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
@@ -26,6 +26,7 @@
 #include <unordered_map>
 #include <map>
 #include <functional>
+#include <chrono>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -45,6 +46,7 @@ class Score;
 class Note;
 class EngravingItem;
 class Segment;
+class Measure;
 class Instrument;
 class RepeatList;
 
@@ -64,6 +66,14 @@ public:
     bool isPlayChordSymbolsEnabled() const;
     void setPlayChordSymbols(const bool isEnabled);
 
+    //! NOTE If enabled, load() renders only the beginning of the score,
+    //!      the rest is rendered in chunks of about chunkDuration on the next event loop iterations
+    bool isIncrementalLoadEnabled() const;
+    void setIncrementalLoad(const bool isEnabled, const std::chrono::milliseconds chunkDuration = std::chrono::milliseconds(20));
+
+    //! NOTE Renders the rest of the score at once, e.g. before an offline render of the whole score
+    void finishIncrementalLoad();
+
     const InstrumentTrackId& metronomeTrackId() const;
     InstrumentTrackId chordSymbolsTrackId(const ID& partId) const;
     bool isChordSymbolsTrack(const InstrumentTrackId& trackId) const;
@@ -96,20 +106,44 @@ private:
         track_idx_t trackTo = mu::nidx;
     };
 
+    //! NOTE The context values the events of a chord-rest have been rendered with
+    struct RenderingInput
+    {
+        InstrumentTrackId trackId;
+        int positionTick = 0;
+        mpe::dynamic_level_t dynamicLevel = 0;
+        mpe::ArticulationType persistentArticulation = mpe::ArticulationType::Undefined;
+    };
+
+    //! NOTE The events of a single staff in a single measure, rendered for one pass through the measure
+    struct RenderedMeasureEvents
+    {
+        int tickPositionOffset = 0;
+        std::vector<RenderingInput> inputs;
+        std::unordered_map<InstrumentTrackId, mpe::PlaybackEventsMap> events;
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
 
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
+    void loadNextChunk(const bool isTimeLimited);
+    bool isIncrementalLoadFinished() const;
+    void notifyAboutLoadedEvents();
     void updateSetupData();
     void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
     void updateContext(const InstrumentTrackId& trackId);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
-    void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
-                        ChangedTrackIdSet* trackChanges);
+    void renderMeasure(const int tickPositionOffset, const Measure* measure, const staff_idx_t staffIdx, const int tickFrom,
+                       const int tickTo, RenderedMeasureEvents& result);
+    void processSegment(const int tickPositionOffset, const Segment* segment, const staff_idx_t staffIdx, RenderedMeasureEvents& result);
+    bool canBeReplayed(const RenderedMeasureEvents& measureEvents, const int tickPositionOffset) const;
+    void applyEvents(RenderedMeasureEvents&& measureEvents, ChangedTrackIdSet* trackChanges);
+    void applyEvents(const RenderedMeasureEvents& measureEvents, const mpe::timestamp_t timestampOffset, ChangedTrackIdSet* trackChanges);
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
@@ -133,6 +167,13 @@ private:
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
     bool m_playChordSymbols = true;
+    bool m_incrementalLoad = false;
+    std::chrono::milliseconds m_incrementalChunkDuration = std::chrono::milliseconds(20);
+
+    int m_incrementalLoadTick = -1;
+    size_t m_incrementalChunkMeasures = 1;
+    size_t m_incrementalLoadedMeasures = 0;
+    size_t m_incrementalNotifiedMeasures = 0;
 
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
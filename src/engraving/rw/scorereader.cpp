@@ -21,6 +21,8 @@
  */
 #include "scorereader.h"
 
+#include <memory>
+
 #include "io/buffer.h"
 
 #include "compat/readstyle.h"
@@ -100,36 +102,25 @@ Err ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscReader,
     }
 
     // Read excerpts
+    //! NOTE The excerpts are loaded on demand, see Excerpt::load.
+    //! Until then, only their name, a few properties and the raw data are kept
     if (masterScore->mscVersion() >= 400) {
+        auto linksCtx = std::make_shared<ReadContext>(masterScore);
+        linksCtx->initLinks(masterScoreCtx);
+
         std::vector<String> excerptNames = mscReader.excerptNames();
         for (const String& excerptName : excerptNames) {
-            Score* partScore = masterScore->createScore();
-
-            compat::ReadStyleHook::setupDefaultStyle(partScore);
-
             Excerpt* ex = new Excerpt(masterScore);
-            ex->setExcerptScore(partScore);
+            ex->setName(excerptName);
 
             ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptName);
-            Buffer excerptStyleBuf(&excerptStyleData);
-            excerptStyleBuf.open(IODevice::ReadOnly);
-            partScore->style().read(&excerptStyleBuf);
-
             ByteArray excerptData = mscReader.readExcerptFile(excerptName);
 
-            ReadContext ctx(partScore);
-            ctx.initLinks(masterScoreCtx);
+            readExcerptProperties(ex, excerptData, excerptName);
 
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptName);
-            xml.setContext(&ctx);
-
-            Read400::read400(partScore, xml, ctx);
-
-            partScore->linkMeasures(masterScore);
-            ex->setTracksMapping(xml.context()->tracks());
-
-            ex->setName(excerptName);
+            ex->setDeferred(excerptStyleData, excerptData, [linksCtx](Excerpt* excerpt) {
+                loadExcerpt(excerpt, *linksCtx);
+            });
 
             masterScore->addExcerpt(ex);
         }
@@ -146,6 +137,74 @@ Err ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscReader,
     return retval;
 }
 
+void ScoreReader::loadExcerpt(Excerpt* ex, const ReadContext& linksCtx)
+{
+    TRACEFUNC;
+
+    ScoreLoad sl;
+
+    MasterScore* masterScore = ex->masterScore();
+    String excerptName = ex->name();
+
+    Score* partScore = masterScore->createScore();
+
+    compat::ReadStyleHook::setupDefaultStyle(partScore);
+
+    ByteArray excerptStyleData = ex->deferredStyleData();
+    Buffer excerptStyleBuf(&excerptStyleData);
+    excerptStyleBuf.open(IODevice::ReadOnly);
+    partScore->style().read(&excerptStyleBuf);
+
+    ex->setExcerptScore(partScore);
+
+    ReadContext ctx(partScore);
+    ctx.initLinks(linksCtx);
+
+    XmlReader xml(ex->deferredScoreData());
+    xml.setDocName(excerptName);
+    xml.setContext(&ctx);
+
+    Read400::read400(partScore, xml, ctx);
+
+    partScore->linkMeasures(masterScore);
+    ex->setTracksMapping(xml.context()->tracks());
+
+    ex->setName(excerptName);
+}
+
+void ScoreReader::readExcerptProperties(Excerpt* ex, const ByteArray& data, const String& docName)
+{
+    XmlReader e(data);
+    e.setDocName(docName);
+
+    if (!e.readNextStartElement() || e.name() != "museScore") {
+        return;
+    }
+
+    while (e.readNextStartElement()) {
+        if (e.name() != "Score") {
+            e.skipCurrentElement();
+            continue;
+        }
+
+        while (e.readNextStartElement()) {
+            const AsciiStringView tag(e.name());
+            if (tag == "initialPartId") {
+                ex->setInitialPartId(ID(e.readInt()));
+            } else if (tag == "open") {
+                ex->setDeferredOpen(e.readBool());
+            } else if (tag == "Part" || tag == "Staff") {
+                // the properties are written before the parts and the staves
+                return;
+            } else {
+                e.skipCurrentElement();
+            }
+        }
+
+        return;
+    }
+}
+
 Err ScoreReader::read(MasterScore* score, XmlReader& e, ReadContext& ctx, compat::ReadStyleHook* styleHook)
 {
     while (e.readNextStartElement()) {
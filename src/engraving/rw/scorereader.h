@@ -44,6 +44,9 @@ private:
 
     Err read(MasterScore* score, XmlReader&, ReadContext& ctx, compat::ReadStyleHook* styleHook = nullptr);
     Err doRead(MasterScore* score, XmlReader& e, ReadContext& ctx);
+
+    static void loadExcerpt(Excerpt* ex, const ReadContext& linksCtx);
+    static void readExcerptProperties(Excerpt* ex, const ByteArray& data, const String& docName);
 };
 }
 
@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "io/buffer.h"
+#include "io/file.h"
+
+#include "infrastructure/mscwriter.h"
+#include "libmscore/excerpt.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/part.h"
+#include "libmscore/staff.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::engraving;
+
+static const String EXCERPTLOAD_DATA_DIR("chordsymbol_data/");
+
+class Engraving_ExcerptLoadTests : public ::testing::Test
+{
+public:
+    // writes the score with a part for every instrument to a 4.x file
+    static bool saveScoreWithParts(const String& sourceName, const String& fileName)
+    {
+        MasterScore* score = ScoreRW::readScore(EXCERPTLOAD_DATA_DIR + sourceName);
+        if (!score) {
+            return false;
+        }
+
+        for (size_t i = 0; i < score->parts().size(); ++i) {
+            Part* part = score->parts().at(i);
+            Excerpt* ex = new Excerpt(score);
+            Score* partScore = score->createScore();
+            ex->setExcerptScore(partScore);
+            partScore->setExcerpt(ex);
+            score->excerpts().push_back(ex);
+            ex->setName(u"part" + String::number(i + 1));
+            ex->setParts({ part });
+            Excerpt::createExcerpt(ex);
+        }
+
+        score->setExcerptsChanged(true);
+        score->doLayout();
+
+        ByteArray msczData;
+        {
+            Buffer buf(&msczData);
+            MscWriter::Params params;
+            params.device = &buf;
+            params.filePath = fileName;
+            params.mode = MscIoMode::Zip;
+
+            MscWriter writer(params);
+            writer.open();
+
+            if (!score->writeMscz(writer, false, false)) {
+                delete score;
+                return false;
+            }
+        }
+
+        delete score;
+
+        File file(fileName);
+        if (!file.open(IODevice::WriteOnly)) {
+            return false;
+        }
+
+        return file.write(msczData) == msczData.size();
+    }
+};
+
+TEST_F(Engraving_ExcerptLoadTests, excerptsAreLoadedOnDemand)
+{
+    ASSERT_TRUE(saveScoreWithParts(u"no-system.mscx", u"excerptload-parts.mscz"));
+
+    // open the 4.x file
+    MasterScore* score = ScoreRW::readScore(u"excerptload-parts.mscz", true);
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->excerpts().size(), 2);
+
+    // the parts are known, but not loaded, and the layout of the score doesn't load them
+    Excerpt* first = score->excerpts().at(0);
+    Excerpt* second = score->excerpts().at(1);
+
+    EXPECT_EQ(first->name(), u"part1");
+    EXPECT_FALSE(first->isLoaded());
+    EXPECT_FALSE(second->isLoaded());
+    EXPECT_FALSE(first->isEmpty());
+    EXPECT_FALSE(first->excerptScore());
+    EXPECT_EQ(score->scoreList().size(), 1);
+
+    // opening a part loads only this part
+    first->load();
+    Score* firstScore = first->excerptScore();
+    ASSERT_TRUE(firstScore);
+    EXPECT_TRUE(first->isLoaded());
+    EXPECT_FALSE(second->isLoaded());
+    EXPECT_EQ(firstScore->parts().size(), 1);
+    EXPECT_EQ(score->scoreList().size(), 2);
+
+    // editing the score loads the rest of the parts, so that they get the changes
+    score->startCmd();
+    EXPECT_TRUE(second->isLoaded());
+    EXPECT_EQ(score->scoreList().size(), 3);
+    score->endCmd();
+
+    delete score;
+}
+
+TEST_F(Engraving_ExcerptLoadTests, loadAllExcerpts)
+{
+    ASSERT_TRUE(saveScoreWithParts(u"no-system.mscx", u"excerptload-all-parts.mscz"));
+
+    MasterScore* score = ScoreRW::readScore(u"excerptload-all-parts.mscz", true);
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->excerpts().size(), 2);
+
+    // the batch exports load all the parts at once
+    score->loadExcerpts();
+
+    for (size_t i = 0; i < score->excerpts().size(); ++i) {
+        Excerpt* ex = score->excerpts().at(i);
+        EXPECT_TRUE(ex->isLoaded());
+
+        // every part is linked to its instrument in the master score
+        Score* partScore = ex->excerptScore();
+        ASSERT_TRUE(partScore);
+        ASSERT_EQ(partScore->nstaves(), 1);
+        EXPECT_TRUE(partScore->staff(0)->isLinked(score->staff(i)));
+    }
+
+    EXPECT_EQ(score->scoreList().size(), 3);
+
+    delete score;
+}
+
+TEST_F(Engraving_ExcerptLoadTests, renameUnloadedExcerpt)
+{
+    ASSERT_TRUE(saveScoreWithParts(u"no-system.mscx", u"excerptload-rename.mscz"));
+
+    MasterScore* score = ScoreRW::readScore(u"excerptload-rename.mscz", true);
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->excerpts().size(), 2);
+
+    Excerpt* first = score->excerpts().at(0);
+    Excerpt* second = score->excerpts().at(1);
+    ASSERT_FALSE(first->isLoaded());
+
+    // renaming the part loads it, so that the new name is written to the part score
+    first->setName(u"renamed");
+
+    EXPECT_TRUE(first->isLoaded());
+    EXPECT_FALSE(second->isLoaded());
+    ASSERT_TRUE(first->excerptScore());
+    EXPECT_EQ(first->excerptScore()->metaTag(u"partName"), u"renamed");
+
+    delete score;
+}
@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include "libmscore/beam.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/page.h"
@@ -152,3 +153,59 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   firstPageCrossStaffBeams
+//    For use with Score::scanElements, collects the
+//    positions of the cross-staff beams on the first page
+//---------------------------------------------------------
+
+static void firstPageCrossStaffBeams(void* data, EngravingItem* e)
+{
+    if (!e->isBeam() || !toBeam(e)->cross()) {
+        return;
+    }
+
+    const EngravingItem* system = e->findAncestor(ElementType::SYSTEM);
+    if (!system || toSystem(system)->page() != e->score()->pages().front()) {
+        return;
+    }
+
+    std::vector<RectF>* result = static_cast<std::vector<RectF>*>(data);
+    result->push_back(e->canvasBoundingRect());
+}
+
+TEST_F(Engraving_LayoutElementsTests, tstRelayoutCrossStaffReusedSystems)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    EXPECT_TRUE(score);
+
+    score->style().set(Sid::enableVerticalSpread, false);
+    score->doLayout();
+
+    // relayout only the first measure: the following systems of the page are reused,
+    // but distributeStaves moves their staves
+    score->style().set(Sid::enableVerticalSpread, true);
+    score->startCmd();
+    score->setLayout(score->firstMeasure()->tick(), 0);
+    score->endCmd();
+
+    std::vector<RectF> rangeLayoutBeams;
+    score->scanElements(&rangeLayoutBeams, firstPageCrossStaffBeams);
+
+    score->doLayout();
+
+    std::vector<RectF> fullLayoutBeams;
+    score->scanElements(&fullLayoutBeams, firstPageCrossStaffBeams);
+
+    // the cross-staff beams should be where a full layout puts them
+    EXPECT_FALSE(fullLayoutBeams.empty());
+    ASSERT_EQ(rangeLayoutBeams.size(), fullLayoutBeams.size());
+    for (size_t i = 0; i < fullLayoutBeams.size(); ++i) {
+        EXPECT_NEAR(rangeLayoutBeams.at(i).x(), fullLayoutBeams.at(i).x(), 0.01);
+        EXPECT_NEAR(rangeLayoutBeams.at(i).y(), fullLayoutBeams.at(i).y(), 0.01);
+        EXPECT_NEAR(rangeLayoutBeams.at(i).height(), fullLayoutBeams.at(i).height(), 0.01);
+    }
+
+    delete score;
+}
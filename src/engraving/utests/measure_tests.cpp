@@ -23,9 +23,11 @@
 #include <gtest/gtest.h>
 
 #include "libmscore/engravingitem.h"
+#include "libmscore/excerpt.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/measurenumber.h"
+#include "libmscore/part.h"
 #include "libmscore/rest.h"
 #include "libmscore/segment.h"
 #include "libmscore/undo.h"
@@ -477,6 +479,65 @@ TEST_F(Engraving_MeasureTests, mmrest)
     delete score;
 }
 
+//---------------------------------------------------------
+///   mmrestParts
+///    mmrest creation in several parts laid out by one command
+//---------------------------------------------------------
+
+TEST_F(Engraving_MeasureTests, mmrestParts)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"mmrest.mscx");
+    EXPECT_TRUE(score);
+
+    std::vector<Score*> partScores;
+    for (int i = 0; i < 3; ++i) {
+        Score* nscore = score->createScore();
+
+        Excerpt* ex = new Excerpt(score);
+        ex->setExcerptScore(nscore);
+        nscore->setExcerpt(ex);
+        score->excerpts().push_back(ex);
+        ex->setName(String(u"Part %1").arg(i));
+        ex->setParts({ score->parts().front() });
+        Excerpt::createExcerpt(ex);
+        nscore->style().set(Sid::createMultiMeasureRests, false);
+
+        partScores.push_back(nscore);
+    }
+
+    score->setExcerptsChanged(true);
+    score->doLayout();
+
+    //! NOTE All the parts push their mmrests onto the one undo stack of the master score
+    score->startCmd();
+    for (Score* partScore : partScores) {
+        partScore->undo(new ChangeStyleVal(partScore, Sid::createMultiMeasureRests, true));
+    }
+    score->setLayoutAll();
+    score->endCmd(false, true);
+
+    auto hasMMRest = [](const Score* s) {
+        for (const Measure* m = s->firstMeasure(); m; m = m->nextMeasure()) {
+            if (m->mmRest()) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const Score* partScore : partScores) {
+        EXPECT_TRUE(hasMMRest(partScore));
+    }
+
+    score->undoRedo(true, nullptr);
+
+    for (const Score* partScore : partScores) {
+        EXPECT_FALSE(hasMMRest(partScore));
+    }
+
+    delete score;
+}
+
 //---------------------------------------------------------
 ///   measureNumbers
 ///    test measure numbers properties
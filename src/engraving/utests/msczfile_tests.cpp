@@ -87,3 +87,76 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_WriteDeferred)
+{
+    //! CASE The deferred writer collects the datas in memory and writes them on request
+
+    //! GIVEN Some datas
+
+    const ByteArray originScoreData("score");
+    const ByteArray originImageData("image");
+
+    //! DO Write datas to a deferred writer
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "deferred1.mscz";
+        params.mode = MscIoMode::Zip;
+        params.deferred = true;
+
+        MscWriter writer(params);
+        EXPECT_TRUE(writer.open());
+
+        writer.writeScoreFile(originScoreData);
+        writer.addImageFile(u"image1.png", originImageData);
+
+        //! CHECK Nothing is written yet
+        EXPECT_TRUE(msczData.empty());
+
+        //! DO Write the collected datas
+        EXPECT_TRUE(writer.writeDeferred());
+        EXPECT_FALSE(writer.isOpened());
+    }
+
+    //! CHECK Read and compare with origin
+    {
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "deferred1.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        EXPECT_EQ(reader.readScoreFile(), originScoreData);
+        EXPECT_EQ(reader.readImageFile(u"image1.png"), originImageData);
+    }
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_DiscardDeferred)
+{
+    //! CASE The deferred writer destroyed without writing discards the datas
+
+    //! DO Write datas to a deferred writer, don't write them
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "deferred2.mscz";
+        params.mode = MscIoMode::Zip;
+        params.deferred = true;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(ByteArray("score"));
+    }
+
+    //! CHECK Nothing is written
+    EXPECT_TRUE(msczData.empty());
+}
@@ -23,9 +23,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <memory>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
+#include "async/processevents.h"
 #include "mpe/tests/utils/articulationutils.h"
 #include "mpe/tests/mocks/articulationprofilesrepositorymock.h"
 
@@ -35,6 +37,7 @@
 #include "libmscore/chord.h"
 
 #include "playback/playbackmodel.h"
+#include "playback/utils/arrangementutils.h"
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -104,6 +107,140 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat)
     EXPECT_EQ(result.size(), expectedSize);
 }
 
+/**
+ * @brief PlaybackModelTests_SimpleRepeat_RepeatedEvents
+ * @details The same score as in the SimpleRepeat case. Measures 2 and 3 are played twice,
+ *          the events of the second pass must be the same as the events of the first pass, shifted in time
+ */
+TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_RepeatedEvents)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [WHEN] The playback model requested to be loaded
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.load(score);
+
+    const PlaybackEventsMap& result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+
+    std::vector<NoteEvent> noteEvents;
+    for (const auto& pair : result) {
+        for (const PlaybackEvent& event : pair.second) {
+            ASSERT_TRUE(std::holds_alternative<NoteEvent>(event));
+            noteEvents.push_back(std::get<NoteEvent>(event));
+        }
+    }
+
+    ASSERT_EQ(noteEvents.size(), 24);
+
+    // [THEN] Measures 2 and 3 (events 4..11) are played again right after measure 3 (events 12..19)
+    constexpr size_t FIRST_PASS_START = 4;
+    constexpr size_t SECOND_PASS_START = 12;
+    constexpr size_t REPEATED_EVENTS_COUNT = 8;
+
+    timestamp_t passOffset = noteEvents.at(SECOND_PASS_START).arrangementCtx().nominalTimestamp
+                             - noteEvents.at(FIRST_PASS_START).arrangementCtx().nominalTimestamp;
+
+    // [THEN] Two measures of 4/4 on 120 bpm last for 4 seconds
+    EXPECT_NEAR(passOffset, 4000000, 1);
+
+    for (size_t i = 0; i < REPEATED_EVENTS_COUNT; ++i) {
+        const NoteEvent& firstPassEvent = noteEvents.at(FIRST_PASS_START + i);
+        const NoteEvent& secondPassEvent = noteEvents.at(SECOND_PASS_START + i);
+
+        EXPECT_EQ(secondPassEvent.arrangementCtx().nominalTimestamp, firstPassEvent.arrangementCtx().nominalTimestamp + passOffset);
+        EXPECT_EQ(secondPassEvent.arrangementCtx().nominalDuration, firstPassEvent.arrangementCtx().nominalDuration);
+        EXPECT_EQ(secondPassEvent.pitchCtx(), firstPassEvent.pitchCtx());
+        EXPECT_EQ(secondPassEvent.expressionCtx().nominalDynamicLevel, firstPassEvent.expressionCtx().nominalDynamicLevel);
+    }
+}
+
+/**
+ * @brief PlaybackModelTests_Incremental_Load
+ * @details The model loaded in chunks must contain exactly the same events as the model loaded at once.
+ *          With no time for a chunk, every chunk renders one measure, the sequencers get the events
+ *          after 1, 2 and 4 measures and at the end
+ */
+TEST_F(Engraving_PlaybackModelTests, Incremental_Load)
+{
+    // [GIVEN] Score with D.S. al Coda, so that some measures are played twice
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "dal_segno_al_coda/dal_segno_al_coda.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+    ASSERT_EQ(score->nmeasures(), 6);
+
+    const Part* part = score->parts().at(0);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [GIVEN] The model loaded at once
+    PlaybackModel expectedModel;
+    expectedModel.setprofilesRepository(m_repositoryMock);
+    expectedModel.load(score);
+
+    const PlaybackEventsMap& expectedEvents
+        = expectedModel.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+
+    // [GIVEN] The model, which renders one measure per chunk
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.setIncrementalLoad(true, std::chrono::milliseconds(0));
+
+    int dataChangedCount = 0;
+    model.dataChanged().onNotify(this, [&dataChangedCount]() {
+        dataChangedCount++;
+    });
+
+    // [WHEN] The model is loaded
+    model.load(score);
+
+    // [THEN] Only the first chunk is loaded
+    EXPECT_EQ(dataChangedCount, 1);
+
+    // [WHEN] The rest of the score is loaded on the next event loop iterations
+    PlaybackData data = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
+
+    std::vector<PlaybackEventsMap> sentEvents;
+    sentEvents.push_back(data.originEvents);
+
+    data.mainStream.onReceive(this, [&sentEvents](const PlaybackEventsMap& events) {
+        sentEvents.push_back(events);
+    });
+
+    for (int i = 0; i < 1000 && dataChangedCount < 2; ++i) {
+        async::processEvents();
+    }
+
+    // [THEN] The load is finished with the last chunk
+    EXPECT_EQ(dataChangedCount, 2);
+
+    // [THEN] The events are sent after 1, 2, 4 measures and once more at the end,
+    //        every time with the events of more measures
+    ASSERT_EQ(sentEvents.size(), 4);
+    for (size_t i = 1; i < sentEvents.size(); ++i) {
+        EXPECT_LT(sentEvents.at(i - 1).size(), sentEvents.at(i).size());
+    }
+
+    // [THEN] The first chunk contains the events of the first measure only
+    ASSERT_FALSE(sentEvents.front().empty());
+    EXPECT_LT(sentEvents.front().rbegin()->first, timestampFromTicks(score, score->firstMeasure()->endTick().ticks()));
+
+    // [THEN] The last sent events are the same as the events of the model loaded at once
+    EXPECT_EQ(sentEvents.back(), expectedEvents);
+    EXPECT_EQ(model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents, expectedEvents);
+}
+
 /**
  * @brief PlaybackModelTests_Two_Ending_Repeat
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 6 measures
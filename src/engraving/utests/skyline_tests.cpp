@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "libmscore/arpeggio.h"
+#include "libmscore/factory.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/skyline.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SKYLINE_DATA_DIR("measure_data/");
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+public:
+    static void compareLines(const SkylineLine& line, const SkylineLine& expected)
+    {
+        ASSERT_EQ(std::distance(line.begin(), line.end()), std::distance(expected.begin(), expected.end()));
+
+        auto it = expected.begin();
+        for (const SkylineSegment& segment : line) {
+            EXPECT_EQ(segment.x, it->x);
+            EXPECT_EQ(segment.y, it->y);
+            EXPECT_EQ(segment.w, it->w);
+            EXPECT_EQ(segment.staffSpan, it->staffSpan);
+            ++it;
+        }
+    }
+
+    // adds random shapes to skyline as whole shapes and to expected element by element
+    static void addRandomShapes(Skyline& skyline, Skyline& expected, const EngravingItem* crossStaffItem, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> shapeCount(1, 40);
+        std::uniform_int_distribution<int> elementCount(1, 8);
+        std::uniform_real_distribution<double> position(-10.0, 100.0);
+        std::uniform_real_distribution<double> offset(-5.0, 15.0);
+        std::uniform_real_distribution<double> size(0.0, 12.0);
+        std::uniform_int_distribution<int> kind(0, 7);
+
+        for (int i = shapeCount(random); i > 0; --i) {
+            Shape shape;
+            double x = position(random);
+            for (int j = elementCount(random); j > 0; --j) {
+                RectF r(x + offset(random), offset(random) - 5.0, size(random), size(random));
+                switch (kind(random)) {
+                case 0:
+                    r.setWidth(0.0); // zero width
+                    break;
+                case 1:
+                    shape.add(r, crossStaffItem);
+                    continue;
+                default:
+                    break;
+                }
+                shape.add(r);
+            }
+
+            skyline.add(shape);
+            for (const ShapeElement& r : shape) {
+                expected.add(r);
+            }
+        }
+    }
+};
+
+TEST_F(Engraving_SkylineTests, addShapeAsElements)
+{
+    for (unsigned seed = 0; seed < 100; ++seed) {
+        Skyline skyline;
+        Skyline expected;
+        addRandomShapes(skyline, expected, nullptr, seed);
+
+        compareLines(skyline.north(), expected.north());
+        compareLines(skyline.south(), expected.south());
+    }
+}
+
+TEST_F(Engraving_SkylineTests, addShapeAsElementsCrossStaff)
+{
+    MasterScore* score = ScoreRW::readScore(SKYLINE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    // the segments of a cross-staff arpeggio have staffSpan 1
+    Arpeggio* arpeggio = Factory::createArpeggio(score->dummy()->chord());
+    arpeggio->setSpan(2);
+
+    for (unsigned seed = 0; seed < 100; ++seed) {
+        Skyline skyline;
+        Skyline expected;
+        addRandomShapes(skyline, expected, arpeggio, seed);
+
+        compareLines(skyline.north(), expected.north());
+        compareLines(skyline.south(), expected.south());
+
+        // the staff spans affect the distance to the next staff
+        Skyline below;
+        below.add(RectF(0.0, 0.0, 120.0, 4.0));
+        EXPECT_EQ(skyline.minDistance(below), expected.minDistance(below));
+    }
+
+    delete arpeggio;
+    delete score;
+}
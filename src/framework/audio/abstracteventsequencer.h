@@ -23,8 +23,9 @@
 #ifndef MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -33,6 +34,7 @@
 
 #include "internal/audiosanitizer.h"
 #include "audiotypes.h"
+#include "eventtimeline.h"
 
 namespace mu::audio {
 template<class ... Types>
@@ -40,11 +42,10 @@ class AbstractEventSequencer : public async::Asyncable
 {
 public:
     using EventType = std::variant<Types...>;
-    using EventSequence = std::set<EventType>;
-    using EventSequenceMap = std::map<msecs_t, EventSequence>;
+    using EventSequence = std::vector<EventType>;
+    using Timeline = EventTimeline<EventType>;
 
-    typedef typename EventSequenceMap::const_iterator SequenceIterator;
-    typedef typename EventSequence::const_iterator EventIterator;
+    typedef typename Timeline::const_iterator SequenceIterator;
 
     virtual ~AbstractEventSequencer()
     {
@@ -69,8 +70,15 @@ public:
         });
 
         m_mainStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
+            msecs_t changedFrom = 0;
+            msecs_t changedTo = 0;
+
+            if (!findChangedRange(m_playbackEventsMap, changes, changedFrom, changedTo)) {
+                return;
+            }
+
             m_playbackEventsMap = changes;
-            updateMainStreamEvents(changes);
+            updateMainStreamEvents(m_playbackEventsMap, changedFrom, changedTo);
         });
 
         m_dynamicLevelChanges.onReceive(this, [this](const mpe::DynamicLevelMap& changes) {
@@ -86,6 +94,16 @@ public:
     virtual void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) = 0;
     virtual void updateDynamicChanges(const mpe::DynamicLevelMap& changes) = 0;
 
+    //! NOTE Only the events from [changedFrom, changedTo] differ from the previous version of the events,
+    //!      sequencers that can rebuild a part of the timeline should override it
+    virtual void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const msecs_t changedFrom, const msecs_t changedTo)
+    {
+        UNUSED(changedFrom);
+        UNUSED(changedTo);
+
+        updateMainStreamEvents(events);
+    }
+
     async::Notification flushedOffStreamEvents() const
     {
         return m_offStreamFlushed;
@@ -139,11 +157,11 @@ public:
         return std::prev(upper)->second;
     }
 
-    EventSequence eventsToBePlayed(const msecs_t nextMsecs)
+    const EventSequence& eventsToBePlayed(const msecs_t nextMsecs)
     {
         ONLY_AUDIO_WORKER_THREAD;
 
-        EventSequence result;
+        EventSequence& result = m_eventsToBePlayed;
 
         result.clear();
 
@@ -152,7 +170,7 @@ public:
             return result;
         }
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        if (m_currentMainSequenceIt == m_mainStreamEvents.end()) {
             return result;
         }
 
@@ -168,75 +186,114 @@ protected:
     void resetAllIterators()
     {
         updateMainSequenceIterator();
-        updateOffSequenceIterator();
+        m_currentOffSequenceIt = m_offStreamEvents.begin();
         updateDynamicChangesIterator();
     }
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_currentMainSequenceIt = m_mainStreamEvents.lowerBound(m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
     {
-        m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_currentOffSequenceIt = m_offStreamEvents.begin();
+        m_offStreamPosition = 0;
     }
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_currentDynamicsIt = m_dynamicEvents.lowerBound(m_playbackPosition);
     }
 
     void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
     {
-        if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+        if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.end()) {
             return;
         }
 
-        if (m_currentOffSequenceIt->first <= nextMsecs) {
-            result = m_currentOffSequenceIt->second;
-            m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
-        } else {
-            auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
-            node.key() -= nextMsecs;
-            m_offStreamEvents.insert(std::move(node));
-            updateOffSequenceIterator();
-        }
+        //! NOTE The off stream is played from the moment it has been received, regardless of the playback position.
+        //! Played events are removed, so that they won't be played again after the playback position changes
+        takeEvents(result, m_currentOffSequenceIt, m_offStreamEvents.end(), m_offStreamPosition + nextMsecs);
+        m_offStreamPosition += nextMsecs;
+
+        m_offStreamEvents.erase(m_offStreamEvents.begin(), m_currentOffSequenceIt);
+        m_currentOffSequenceIt = m_offStreamEvents.begin();
     }
 
     void handleMainStream(EventSequence& result)
     {
-        if (m_currentMainSequenceIt->first <= m_playbackPosition) {
-            result.insert(m_currentMainSequenceIt->second.cbegin(),
-                          m_currentMainSequenceIt->second.cend());
-
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
-        }
+        takeEvents(result, m_currentMainSequenceIt, m_mainStreamEvents.end(), m_playbackPosition);
     }
 
     void handleDynamicChanges(EventSequence& result)
     {
-        if (m_dynamicEvents.empty() || m_currentDynamicsIt == m_dynamicEvents.cend()) {
-            return;
+        takeEvents(result, m_currentDynamicsIt, m_dynamicEvents.end(), m_playbackPosition);
+    }
+
+    static void takeEvents(EventSequence& result, SequenceIterator& it, const SequenceIterator& end, const msecs_t position)
+    {
+        Timeline::take(result, it, end, position);
+    }
+
+    //! NOTE Finds the range of timestamps outside of which both maps are equal
+    static bool findChangedRange(const mpe::PlaybackEventsMap& before, const mpe::PlaybackEventsMap& after,
+                                 msecs_t& changedFrom, msecs_t& changedTo)
+    {
+        auto beforeIt = before.cbegin();
+        auto afterIt = after.cbegin();
+
+        while (beforeIt != before.cend() && afterIt != after.cend() && *beforeIt == *afterIt) {
+            ++beforeIt;
+            ++afterIt;
+        }
+
+        if (beforeIt == before.cend() && afterIt == after.cend()) {
+            return false;
         }
 
-        if (m_currentDynamicsIt->first <= m_playbackPosition) {
-            result.insert(m_currentDynamicsIt->second.cbegin(),
-                          m_currentDynamicsIt->second.cend());
+        auto beforeRIt = before.crbegin();
+        auto afterRIt = after.crbegin();
 
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+        while (beforeRIt != before.crend() && afterRIt != after.crend() && *beforeRIt == *afterRIt) {
+            ++beforeRIt;
+            ++afterRIt;
         }
+
+        changedFrom = std::numeric_limits<msecs_t>::max();
+        changedTo = std::numeric_limits<msecs_t>::min();
+
+        if (beforeIt != before.cend()) {
+            changedFrom = std::min(changedFrom, beforeIt->first);
+        }
+
+        if (afterIt != after.cend()) {
+            changedFrom = std::min(changedFrom, afterIt->first);
+        }
+
+        if (beforeRIt != before.crend()) {
+            changedTo = std::max(changedTo, beforeRIt->first);
+        }
+
+        if (afterRIt != after.crend()) {
+            changedTo = std::max(changedTo, afterRIt->first);
+        }
+
+        return true;
     }
 
     mutable msecs_t m_playbackPosition = 0;
+    msecs_t m_offStreamPosition = 0;
 
     SequenceIterator m_currentMainSequenceIt;
     SequenceIterator m_currentOffSequenceIt;
     SequenceIterator m_currentDynamicsIt;
 
-    EventSequenceMap m_mainStreamEvents;
-    EventSequenceMap m_offStreamEvents;
-    EventSequenceMap m_dynamicEvents;
+    Timeline m_mainStreamEvents;
+    Timeline m_offStreamEvents;
+    Timeline m_dynamicEvents;
+
+    EventSequence m_eventsToBePlayed;
 
     mpe::DynamicLevelMap m_dynamicLevelMap;
     mpe::PlaybackEventsMap m_playbackEventsMap;
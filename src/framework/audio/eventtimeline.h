@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_EVENTTIMELINE_H
+#define MU_AUDIO_EVENTTIMELINE_H
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE Events sorted by time in a flat array.
+//! Every event remembers the timestamp of the source (playback) event it has been produced from,
+//! so that the events of a changed range of the source can be replaced without rebuilding the whole timeline
+template<class EventType>
+class EventTimeline
+{
+public:
+    struct Entry
+    {
+        msecs_t timestamp = 0;
+        msecs_t sourceTimestamp = 0;
+        EventType event;
+    };
+
+    using Entries = std::vector<Entry>;
+    using const_iterator = typename Entries::const_iterator;
+
+    void setSourceTimestamp(const msecs_t sourceTimestamp)
+    {
+        m_sourceTimestamp = sourceTimestamp;
+    }
+
+    void add(const msecs_t timestamp, const EventType& event)
+    {
+        m_pendingEntries.push_back({ timestamp, m_sourceTimestamp, event });
+    }
+
+    void add(const msecs_t timestamp, EventType&& event)
+    {
+        m_pendingEntries.push_back({ timestamp, m_sourceTimestamp, std::move(event) });
+    }
+
+    //! NOTE Sorts the added events and merges them into the timeline.
+    //! Equal events at the same time produced by the same source event are kept only once,
+    //! the ones of different source events are all kept, so that every source can be removed separately (see take)
+    void commit()
+    {
+        if (m_pendingEntries.empty()) {
+            return;
+        }
+
+        std::sort(m_pendingEntries.begin(), m_pendingEntries.end(), &EventTimeline::isLess);
+        m_pendingEntries.erase(std::unique(m_pendingEntries.begin(), m_pendingEntries.end(), &EventTimeline::isSame),
+                               m_pendingEntries.end());
+
+        if (m_entries.empty()) {
+            m_entries.swap(m_pendingEntries);
+            return;
+        }
+
+        Entries merged;
+        merged.reserve(m_entries.size() + m_pendingEntries.size());
+
+        std::merge(std::make_move_iterator(m_entries.begin()), std::make_move_iterator(m_entries.end()),
+                   std::make_move_iterator(m_pendingEntries.begin()), std::make_move_iterator(m_pendingEntries.end()),
+                   std::back_inserter(merged), &EventTimeline::isLess);
+
+        m_entries.swap(merged);
+        m_pendingEntries.clear();
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_pendingEntries.clear();
+    }
+
+    //! NOTE Removes the events produced by the source events from the range [sourceFrom, sourceTo]
+    void removeSources(const msecs_t sourceFrom, const msecs_t sourceTo)
+    {
+        auto isInRange = [sourceFrom, sourceTo](const Entry& entry) {
+            return entry.sourceTimestamp >= sourceFrom && entry.sourceTimestamp <= sourceTo;
+        };
+
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), isInRange), m_entries.end());
+    }
+
+    void erase(const_iterator first, const_iterator last)
+    {
+        m_entries.erase(first, last);
+    }
+
+    //! NOTE Appends the events from it to position (inclusive) to result and moves it past them.
+    //! Equal events at the same time are taken once, also if they are produced by different source events
+    template<class Container>
+    static void take(Container& result, const_iterator& it, const const_iterator& end, const msecs_t position)
+    {
+        const_iterator last = end;
+
+        while (it != end && it->timestamp <= position) {
+            if (last == end || !isSameEvent(*last, *it)) {
+                result.push_back(it->event);
+            }
+
+            last = it;
+            ++it;
+        }
+    }
+
+    const_iterator lowerBound(const msecs_t timestamp) const
+    {
+        return std::lower_bound(m_entries.cbegin(), m_entries.cend(), timestamp, [](const Entry& entry, const msecs_t value) {
+            return entry.timestamp < value;
+        });
+    }
+
+    const_iterator begin() const
+    {
+        return m_entries.cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return m_entries.cend();
+    }
+
+    bool empty() const
+    {
+        return m_entries.empty();
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    static bool isLess(const Entry& first, const Entry& second)
+    {
+        if (first.timestamp != second.timestamp) {
+            return first.timestamp < second.timestamp;
+        }
+
+        if (first.event < second.event) {
+            return true;
+        }
+
+        if (second.event < first.event) {
+            return false;
+        }
+
+        return first.sourceTimestamp < second.sourceTimestamp;
+    }
+
+    static bool isSameEvent(const Entry& first, const Entry& second)
+    {
+        return first.timestamp == second.timestamp
+               && !(first.event < second.event)
+               && !(second.event < first.event);
+    }
+
+    static bool isSame(const Entry& first, const Entry& second)
+    {
+        return first.sourceTimestamp == second.sourceTimestamp && isSameEvent(first, second);
+    }
+
+    Entries m_entries;
+    Entries m_pendingEntries;
+    msecs_t m_sourceTimestamp = 0;
+};
+}
+
+#endif // MU_AUDIO_EVENTTIMELINE_H
@@ -53,6 +53,11 @@ public:
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
 
+    //! NOTE Saves the master output to destination and every track of stemTrackIds
+    //! to "<destination>-<track name>.<suffix>", all of them in one render pass
+    virtual async::Promise<bool> saveSoundTrackStems(const TrackSequenceId sequenceId, const io::path_t& destination,
+                                                     const SoundTrackFormat& format, const TrackIdList& stemTrackIds) = 0;
+
     virtual framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) = 0;
 
     virtual void clearAllFx() = 0;
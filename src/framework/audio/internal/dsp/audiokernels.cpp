@@ -0,0 +1,448 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "audiokernels.h"
+
+#include <atomic>
+
+#include "log.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MU_AUDIO_KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(MU_AUDIO_KERNELS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define MU_AUDIO_KERNELS_AVX2
+#define MU_AUDIO_KERNELS_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MU_AUDIO_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+namespace {
+struct Kernels
+{
+    InstructionSet set = InstructionSet::Scalar;
+
+    void (* accumulateWithGain)(float* out, const float* in, size_t count, float gain) = nullptr;
+    void (* applyGain)(float* buffer, size_t count, float gain) = nullptr;
+    void (* applyChannelGainsAndMeasure)(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                         const float* channelGains, float* channelSquaredSums) = nullptr;
+};
+
+// ================================================
+// Scalar
+// ================================================
+
+namespace scalar {
+void accumulateWithGain(float* out, const float* in, size_t count, float gain)
+{
+    for (size_t i = 0; i < count; ++i) {
+        out[i] += in[i] * gain;
+    }
+}
+
+void applyGain(float* buffer, size_t count, float gain)
+{
+    for (size_t i = 0; i < count; ++i) {
+        buffer[i] *= gain;
+    }
+}
+
+void applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* channelGains, float* channelSquaredSums)
+{
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        float* frame = buffer + s * audioChannelsCount;
+
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+            float resultSample = frame[audioChNum] * channelGains[audioChNum];
+            frame[audioChNum] = resultSample;
+            channelSquaredSums[audioChNum] += resultSample * resultSample;
+        }
+    }
+}
+
+//! NOTE Finishes the tail of a vectorized buffer, the vectorized part must end on a frame boundary
+void applyChannelGainsAndMeasureTail(float* buffer, size_t from, size_t to, audioch_t audioChannelsCount,
+                                     const float* channelGains, float* channelSquaredSums)
+{
+    for (size_t i = from; i < to; ++i) {
+        audioch_t audioChNum = i % audioChannelsCount;
+        float resultSample = buffer[i] * channelGains[audioChNum];
+        buffer[i] = resultSample;
+        channelSquaredSums[audioChNum] += resultSample * resultSample;
+    }
+}
+
+
+
+const Kernels KERNELS {
+    InstructionSet::Scalar, accumulateWithGain, applyGain, applyChannelGainsAndMeasure
+};
+}
+
+// ================================================
+// SSE2
+// ================================================
+
+#ifdef MU_AUDIO_KERNELS_SSE2
+namespace sse2 {
+constexpr size_t WIDTH = 4;
+
+
+
+void accumulateWithGain(float* out, const float* in, size_t count, float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m128 result = _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), g));
+        _mm_storeu_ps(out + i, result);
+    }
+
+    scalar::accumulateWithGain(out + i, in + i, count - i, gain);
+}
+
+void applyGain(float* buffer, size_t count, float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        _mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), g));
+    }
+
+    scalar::applyGain(buffer + i, count - i, gain);
+}
+
+void applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* channelGains, float* channelSquaredSums)
+{
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        scalar::applyChannelGainsAndMeasure(buffer, audioChannelsCount, samplesPerChannel, channelGains, channelSquaredSums);
+        return;
+    }
+
+    const __m128 g = _mm_setr_ps(channelGains[0], channelGains[1 % audioChannelsCount],
+                                 channelGains[2 % audioChannelsCount], channelGains[3 % audioChannelsCount]);
+    __m128 sum = _mm_setzero_ps();
+
+    const size_t count = static_cast<size_t>(samplesPerChannel) * audioChannelsCount;
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m128 result = _mm_mul_ps(_mm_loadu_ps(buffer + i), g);
+        _mm_storeu_ps(buffer + i, result);
+        sum = _mm_add_ps(sum, _mm_mul_ps(result, result));
+    }
+
+    alignas(16) float lanes[WIDTH];
+    _mm_store_ps(lanes, sum);
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        channelSquaredSums[lane % audioChannelsCount] += lanes[lane];
+    }
+
+    scalar::applyChannelGainsAndMeasureTail(buffer, i, count, audioChannelsCount, channelGains, channelSquaredSums);
+}
+
+
+
+const Kernels KERNELS {
+    InstructionSet::SSE2, accumulateWithGain, applyGain, applyChannelGainsAndMeasure
+};
+}
+#endif
+
+// ================================================
+// AVX2
+// ================================================
+
+#ifdef MU_AUDIO_KERNELS_AVX2
+namespace avx2 {
+constexpr size_t WIDTH = 8;
+
+MU_AUDIO_KERNELS_AVX2_TARGET
+void accumulateWithGain(float* out, const float* in, size_t count, float gain)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m256 result = _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(_mm256_loadu_ps(in + i), g));
+        _mm256_storeu_ps(out + i, result);
+    }
+
+    scalar::accumulateWithGain(out + i, in + i, count - i, gain);
+}
+
+MU_AUDIO_KERNELS_AVX2_TARGET
+void applyGain(float* buffer, size_t count, float gain)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        _mm256_storeu_ps(buffer + i, _mm256_mul_ps(_mm256_loadu_ps(buffer + i), g));
+    }
+
+    scalar::applyGain(buffer + i, count - i, gain);
+}
+
+MU_AUDIO_KERNELS_AVX2_TARGET
+void applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* channelGains, float* channelSquaredSums)
+{
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        scalar::applyChannelGainsAndMeasure(buffer, audioChannelsCount, samplesPerChannel, channelGains, channelSquaredSums);
+        return;
+    }
+
+    alignas(32) float gains[WIDTH];
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        gains[lane] = channelGains[lane % audioChannelsCount];
+    }
+
+    const __m256 g = _mm256_load_ps(gains);
+    __m256 sum = _mm256_setzero_ps();
+
+    const size_t count = static_cast<size_t>(samplesPerChannel) * audioChannelsCount;
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m256 result = _mm256_mul_ps(_mm256_loadu_ps(buffer + i), g);
+        _mm256_storeu_ps(buffer + i, result);
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(result, result));
+    }
+
+    alignas(32) float lanes[WIDTH];
+    _mm256_store_ps(lanes, sum);
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        channelSquaredSums[lane % audioChannelsCount] += lanes[lane];
+    }
+
+    scalar::applyChannelGainsAndMeasureTail(buffer, i, count, audioChannelsCount, channelGains, channelSquaredSums);
+}
+
+
+
+bool isSupported()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+const Kernels KERNELS {
+    InstructionSet::AVX2, accumulateWithGain, applyGain, applyChannelGainsAndMeasure
+};
+}
+#endif
+
+// ================================================
+// NEON
+// ================================================
+
+#ifdef MU_AUDIO_KERNELS_NEON
+namespace neon {
+constexpr size_t WIDTH = 4;
+
+
+
+void accumulateWithGain(float* out, const float* in, size_t count, float gain)
+{
+    const float32x4_t g = vdupq_n_f32(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        float32x4_t result = vaddq_f32(vld1q_f32(out + i), vmulq_f32(vld1q_f32(in + i), g));
+        vst1q_f32(out + i, result);
+    }
+
+    scalar::accumulateWithGain(out + i, in + i, count - i, gain);
+}
+
+void applyGain(float* buffer, size_t count, float gain)
+{
+    const float32x4_t g = vdupq_n_f32(gain);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        vst1q_f32(buffer + i, vmulq_f32(vld1q_f32(buffer + i), g));
+    }
+
+    scalar::applyGain(buffer + i, count - i, gain);
+}
+
+void applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* channelGains, float* channelSquaredSums)
+{
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        scalar::applyChannelGainsAndMeasure(buffer, audioChannelsCount, samplesPerChannel, channelGains, channelSquaredSums);
+        return;
+    }
+
+    float gains[WIDTH];
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        gains[lane] = channelGains[lane % audioChannelsCount];
+    }
+
+    const float32x4_t g = vld1q_f32(gains);
+    float32x4_t sum = vdupq_n_f32(0.f);
+
+    const size_t count = static_cast<size_t>(samplesPerChannel) * audioChannelsCount;
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        float32x4_t result = vmulq_f32(vld1q_f32(buffer + i), g);
+        vst1q_f32(buffer + i, result);
+        sum = vaddq_f32(sum, vmulq_f32(result, result));
+    }
+
+    float lanes[WIDTH];
+    vst1q_f32(lanes, sum);
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        channelSquaredSums[lane % audioChannelsCount] += lanes[lane];
+    }
+
+    scalar::applyChannelGainsAndMeasureTail(buffer, i, count, audioChannelsCount, channelGains, channelSquaredSums);
+}
+
+
+
+const Kernels KERNELS {
+    InstructionSet::NEON, accumulateWithGain, applyGain, applyChannelGainsAndMeasure
+};
+}
+#endif
+
+const Kernels* kernelsFor(InstructionSet set)
+{
+    switch (set) {
+    case InstructionSet::Scalar: return &scalar::KERNELS;
+#ifdef MU_AUDIO_KERNELS_SSE2
+    case InstructionSet::SSE2: return &sse2::KERNELS;
+#endif
+#ifdef MU_AUDIO_KERNELS_AVX2
+    case InstructionSet::AVX2: return avx2::isSupported() ? &avx2::KERNELS : nullptr;
+#endif
+#ifdef MU_AUDIO_KERNELS_NEON
+    case InstructionSet::NEON: return &neon::KERNELS;
+#endif
+    default:
+        break;
+    }
+
+    return nullptr;
+}
+
+std::atomic<const Kernels*>& activeKernels()
+{
+    static std::atomic<const Kernels*> kernels(kernelsFor(availableInstructionSets().back()));
+    return kernels;
+}
+
+const Kernels* kernels()
+{
+    return activeKernels().load(std::memory_order_relaxed);
+}
+}
+
+const char* mu::audio::dsp::instructionSetName(InstructionSet set)
+{
+    switch (set) {
+    case InstructionSet::Scalar: return "Scalar";
+    case InstructionSet::SSE2: return "SSE2";
+    case InstructionSet::AVX2: return "AVX2";
+    case InstructionSet::NEON: return "NEON";
+    }
+
+    return "Unknown";
+}
+
+std::vector<InstructionSet> mu::audio::dsp::availableInstructionSets()
+{
+    //! NOTE Ordered from the slowest to the fastest one
+    std::vector<InstructionSet> result;
+
+    for (InstructionSet set : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::NEON, InstructionSet::AVX2 }) {
+        if (kernelsFor(set)) {
+            result.push_back(set);
+        }
+    }
+
+    return result;
+}
+
+InstructionSet mu::audio::dsp::currentInstructionSet()
+{
+    return kernels()->set;
+}
+
+void mu::audio::dsp::setInstructionSet(InstructionSet set)
+{
+    const Kernels* newKernels = kernelsFor(set);
+
+    IF_ASSERT_FAILED(newKernels) {
+        return;
+    }
+
+    activeKernels().store(newKernels, std::memory_order_relaxed);
+}
+
+void mu::audio::dsp::accumulateWithGain(float* out, const float* in, size_t count, float gain)
+{
+    kernels()->accumulateWithGain(out, in, count, gain);
+}
+
+void mu::audio::dsp::applyGain(float* buffer, size_t count, float gain)
+{
+    kernels()->applyGain(buffer, count, gain);
+}
+
+void mu::audio::dsp::applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                                 const float* channelGains, float* channelSquaredSums)
+{
+    kernels()->applyChannelGainsAndMeasure(buffer, audioChannelsCount, samplesPerChannel, channelGains, channelSquaredSums);
+}
+
+float mu::audio::dsp::applyChannelGainAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                                 audioch_t audioChNum, float gain)
+{
+    float squaredSum = 0.f;
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        float* sample = buffer + s * audioChannelsCount + audioChNum;
+        float resultSample = *sample * gain;
+        *sample = resultSample;
+        squaredSum += resultSample * resultSample;
+    }
+
+    return squaredSum;
+}
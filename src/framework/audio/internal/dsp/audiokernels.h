@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_AUDIOKERNELS_H
+#define MU_AUDIO_AUDIOKERNELS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "audiotypes.h"
+
+//! NOTE Vectorized kernels for the interleaved float buffers processed on every audio callback.
+//! The best instruction set supported by the CPU is selected at runtime on the first call,
+//! the scalar implementation is used as a fallback
+namespace mu::audio::dsp {
+//! NOTE Upper bound for the per-channel values (gains, squared sums) kept on the stack of the audio thread
+static constexpr audioch_t MAX_KERNEL_AUDIO_CHANNELS = 8;
+
+enum class InstructionSet {
+    Scalar,
+    SSE2,
+    AVX2,
+    NEON
+};
+
+const char* instructionSetName(InstructionSet set);
+
+std::vector<InstructionSet> availableInstructionSets();
+InstructionSet currentInstructionSet();
+
+//! NOTE Only for tests and benchmarks, the set must be one of availableInstructionSets()
+void setInstructionSet(InstructionSet set);
+
+//! NOTE out[i] += in[i] * gain
+void accumulateWithGain(float* out, const float* in, size_t count, float gain);
+
+//! NOTE buffer[i] *= gain, used to apply the gain reduction of the limiter and the compressor
+void applyGain(float* buffer, size_t count, float gain);
+
+//! NOTE Applies a separate gain to every audio channel of the interleaved buffer (balance, pan, volume)
+//! and accumulates the squared sum of the result per channel into channelSquaredSums
+void applyChannelGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* channelGains, float* channelSquaredSums);
+
+//! NOTE Applies the gain to one audio channel of the interleaved buffer and returns the squared sum of the result,
+//! the scalar fallback for the layouts with more than MAX_KERNEL_AUDIO_CHANNELS channels
+float applyChannelGainAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 audioch_t audioChNum, float gain);
+}
+
+#endif // MU_AUDIO_AUDIOKERNELS_H
@@ -1,6 +1,7 @@
 #include "limiter.h"
 
 #include "audiomathutils.h"
+#include "audiokernels.h"
 
 using namespace mu::audio;
 using namespace mu::audio::dsp;
@@ -73,7 +74,5 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
     float totalLinearGain = linearFromDecibels(makeUpGain);
 
     // apply linear gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, totalLinearGain);
-    }
+    applyGain(buffer, samplesPerChannel * audioChannelsCount, totalLinearGain);
 }
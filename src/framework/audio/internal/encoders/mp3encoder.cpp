@@ -91,32 +91,40 @@ private:
     SoundTrackFormat m_format;
 };
 
-size_t Mp3Encoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
+size_t Mp3Encoder::requiredOutputBufferSize(samples_t samplesPerChannel) const
 {
-    //!Note See thirdparty/lame/API
+    //!Note See thirdparty/lame/API: mp3buf_size = 1.25 * num_samples + 7200 in the worst case
 
-    return totalSamplesNumber;
+    return samplesPerChannel + samplesPerChannel / 4 + 7200;
 }
 
 size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
 {
     LameHandler::instance()->updateSpec(m_format);
 
-    m_progress.progressChanged.send(0, 100, "");
+    prepareOutputBuffer(samplesPerChannel);
 
     int encodedBytes = lame_encode_buffer_interleaved_ieee_float(LameHandler::instance()->flags, input, samplesPerChannel,
                                                                  m_outputBuffer.data(),
                                                                  static_cast<int>(m_outputBuffer.size()));
 
-    m_progress.progressChanged.send(50, 100, "");
-    size_t result = std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
-    m_progress.progressChanged.send(100, 100, "");
+    if (encodedBytes < 0) {
+        LOGE() << "lame encoding error: " << encodedBytes;
+        return 0;
+    }
+
+    //! NOTE lame keeps a part of the samples for the next blocks, so a block may produce no output
+    if (std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream) != static_cast<size_t>(encodedBytes)) {
+        return 0;
+    }
 
-    return result;
+    return samplesPerChannel;
 }
 
 size_t Mp3Encoder::flush()
 {
+    prepareOutputBuffer(0);
+
     int encodedBytes = lame_encode_flush(LameHandler::instance()->flags,
                                          m_outputBuffer.data(),
                                          static_cast<int>(m_outputBuffer.size()));
@@ -31,19 +31,18 @@ using namespace mu::audio::encode;
 
 size_t OggEncoder::encode(samples_t samplesPerChannel, const float* input)
 {
-    m_progress.progressChanged.send(0, 100, "");
-    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel + m_format.sampleRate * 2);
-    m_progress.progressChanged.send(100, 100, "");
+    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel);
 
     return code == OPE_OK ? samplesPerChannel : 0;
 }
 
 size_t OggEncoder::flush()
 {
-    return ope_encoder_flush_header(m_opusEncoder);
+    //! NOTE Writes the samples the encoder still keeps and finalizes the stream
+    return ope_encoder_drain(m_opusEncoder);
 }
 
-size_t OggEncoder::requiredOutputBufferSize(samples_t /*totalSamplesNumber*/) const
+size_t OggEncoder::requiredOutputBufferSize(samples_t /*samplesPerChannel*/) const
 {
     return 0;
 }
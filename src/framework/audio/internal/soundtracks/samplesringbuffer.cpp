@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "samplesringbuffer.h"
+
+#include <algorithm>
+
+using namespace mu::audio::soundtrack;
+
+SamplesRingBuffer::SamplesRingBuffer(size_t capacity)
+    : m_data(capacity)
+{
+}
+
+bool SamplesRingBuffer::write(const float* data, size_t count)
+{
+    while (count > 0) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_canWrite.wait(lock, [this]() { return m_cancelled || m_size < m_data.size(); });
+
+        if (m_cancelled) {
+            return false;
+        }
+
+        size_t writePos = (m_readPos + m_size) % m_data.size();
+        size_t chunk = std::min({ count, m_data.size() - m_size, m_data.size() - writePos });
+
+        std::copy(data, data + chunk, m_data.begin() + writePos);
+        m_size += chunk;
+        data += chunk;
+        count -= chunk;
+
+        lock.unlock();
+        m_canRead.notify_one();
+    }
+
+    return true;
+}
+
+size_t SamplesRingBuffer::read(float* data, size_t count)
+{
+    size_t result = 0;
+
+    while (result < count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_canRead.wait(lock, [this]() { return m_cancelled || m_closed || m_size > 0; });
+
+        if (m_cancelled || m_size == 0) {
+            break;
+        }
+
+        size_t chunk = std::min({ count - result, m_size, m_data.size() - m_readPos });
+
+        std::copy(m_data.begin() + m_readPos, m_data.begin() + m_readPos + chunk, data + result);
+        m_readPos = (m_readPos + chunk) % m_data.size();
+        m_size -= chunk;
+        result += chunk;
+
+        lock.unlock();
+        m_canWrite.notify_one();
+    }
+
+    return result;
+}
+
+void SamplesRingBuffer::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+    m_canRead.notify_all();
+}
+
+void SamplesRingBuffer::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled = true;
+        m_size = 0;
+    }
+    m_canRead.notify_all();
+    m_canWrite.notify_all();
+}
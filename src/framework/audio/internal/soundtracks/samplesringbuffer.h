@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_SAMPLESRINGBUFFER_H
+#define MU_AUDIO_SAMPLESRINGBUFFER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace mu::audio::soundtrack {
+//! NOTE A bounded single producer / single consumer queue of samples.
+//! The writer blocks while the buffer is full and the reader while it is empty,
+//! so the rendering and the encoding run concurrently in a constant amount of memory
+class SamplesRingBuffer
+{
+public:
+    explicit SamplesRingBuffer(size_t capacity);
+
+    //! NOTE Returns false if the buffer has been cancelled
+    bool write(const float* data, size_t count);
+
+    //! NOTE Waits for exactly count samples, or for fewer when the buffer is closed.
+    //! Returns the number of samples read, 0 means the end of the stream
+    size_t read(float* data, size_t count);
+
+    //! NOTE No more samples will be written, the reader gets the rest
+    void close();
+
+    //! NOTE Wakes up both sides and discards the samples
+    void cancel();
+
+private:
+    std::vector<float> m_data;
+    size_t m_readPos = 0;
+    size_t m_size = 0;
+
+    bool m_closed = false;
+    bool m_cancelled = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_canWrite;
+    std::condition_variable m_canRead;
+};
+}
+
+#endif // MU_AUDIO_SAMPLESRINGBUFFER_H
@@ -22,76 +22,170 @@
 
 #include "soundtrackwriter.h"
 
+#include <set>
+
 #include "internal/worker/audioengine.h"
 #include "internal/encoders/mp3encoder.h"
 #include "internal/encoders/oggencoder.h"
 #include "internal/encoders/flacencoder.h"
 #include "internal/encoders/wavencoder.h"
 
+#include "samplesringbuffer.h"
+
+#include "containers.h"
 #include "defer.h"
 
 using namespace mu;
 using namespace mu::audio;
 using namespace mu::audio::soundtrack;
 
-static constexpr int WRITE_STEPS = 2;
-static constexpr int PREPARE_STEP = 0;
-static constexpr int ENCODE_STEP = 1;
+//! NOTE The encoder gets the samples in blocks of this size (per channel),
+//! the ring buffer between the render and the encoder holds a few of them
+static constexpr samples_t ENCODE_BLOCK_SIZE = 16384;
+static constexpr size_t ENCODE_BLOCKS_IN_BUFFER = 8;
+
+//! NOTE The offline render asks the mixer for chunks of this many render steps,
+//! every track renders its whole chunk on its own thread
+static constexpr samples_t RENDER_STEPS_IN_CHUNK = 64;
 
 SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration,
-                                   IAudioSourcePtr source)
-    : m_source(std::move(source))
+                                   MixerPtr mixer, const std::map<TrackId, io::path_t>& trackDestinations)
+    : m_mixer(std::move(mixer))
 {
-    if (!m_source) {
+    if (!m_mixer) {
         return;
     }
 
-    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
-    m_inputBuffer.resize(totalSamplesNumber);
-    m_intermBuffer.resize(config()->renderStep() * config()->audioChannelsCount());
+    m_totalSamplesPerChannel = (totalDuration / 1000000.f) * format.sampleRate;
+    m_renderBuffer.resize(RENDER_STEPS_IN_CHUNK * config()->renderStep() * config()->audioChannelsCount());
 
-    m_encoderPtr = createEncoder(format.type);
-
-    if (!m_encoderPtr) {
+    EncodeStreamPtr master = createStream(-1, destination, format);
+    if (!master) {
         return;
     }
 
-    m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+    m_streams.push_back(std::move(master));
+
+    for (const auto& pair : trackDestinations) {
+        if (EncodeStreamPtr stream = createStream(pair.first, pair.second, format)) {
+            m_streams.push_back(std::move(stream));
+        }
+    }
+}
+
+std::map<TrackId, io::path_t> SoundTrackWriter::stemDestinations(const io::path_t& destination,
+                                                                 const std::vector<std::pair<TrackId, TrackName> >& tracks)
+{
+    std::vector<String> names;
+    std::map<std::string, size_t> nameCount;
+
+    for (const auto& track : tracks) {
+        String name = io::escapeFileName(track.second).toString();
+        names.push_back(name);
+        nameCount[name.toLower().toStdString()]++;
+    }
+
+    //! NOTE The unique names are kept as they are, the others must not take them
+    std::set<std::string> usedNames;
+    for (const String& name : names) {
+        std::string key = name.toLower().toStdString();
+        if (!name.isEmpty() && nameCount[key] == 1) {
+            usedNames.insert(key);
+        }
+    }
+
+    const io::path_t basePath = io::dirpath(destination) + "/" + io::completeBasename(destination);
+    const io::path_t suffix = io::suffix(destination);
+
+    std::map<TrackId, io::path_t> result;
+
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        String name = names.at(i);
+
+        if (name.isEmpty() || nameCount[name.toLower().toStdString()] > 1) {
+            String baseName = name.isEmpty() ? String(u"track") : name;
+            size_t number = i + 1;
+            name = baseName + u"-" + String::number(number);
+
+            while (mu::contains(usedNames, name.toLower().toStdString())) {
+                number += tracks.size();
+                name = baseName + u"-" + String::number(number);
+            }
+
+            usedNames.insert(name.toLower().toStdString());
+        }
+
+        result[tracks.at(i).first] = basePath + "-" + name + "." + suffix;
+    }
+
+    return result;
+}
+
+SoundTrackWriter::~SoundTrackWriter()
+{
+    for (EncodeStreamPtr& stream : m_streams) {
+        if (stream->thread.joinable()) {
+            stream->buffer->cancel();
+            stream->thread.join();
+        }
+    }
 }
 
 bool SoundTrackWriter::write()
 {
     TRACEFUNC;
 
-    if (!m_source || !m_encoderPtr) {
+    if (!m_mixer || m_streams.empty()) {
         return false;
     }
 
+    if (m_totalSamplesPerChannel == 0) {
+        LOGI() << "No audio to export";
+        return false;
+    }
+
+    const SoundTrackFormat& format = m_streams.front()->encoder->format();
+
     AudioEngine::instance()->setMode(RenderMode::OfflineMode);
 
-    m_source->setSampleRate(m_encoderPtr->format().sampleRate);
-    m_source->setIsActive(true);
+    m_mixer->setSampleRate(format.sampleRate);
+    m_mixer->setIsActive(true);
 
     DEFER {
-        m_encoderPtr->flush();
-
         AudioEngine::instance()->setMode(RenderMode::RealTimeMode);
 
-        m_source->setSampleRate(AudioEngine::instance()->sampleRate());
-        m_source->setIsActive(false);
+        m_mixer->setSampleRate(AudioEngine::instance()->sampleRate());
+        m_mixer->setIsActive(false);
     };
 
-    if (!prepareInputBuffer()) {
-        return false;
+    //! NOTE The render runs on this (the audio worker) thread and every encoder on its own thread,
+    //! they are connected by bounded ring buffers, so the whole piece is never held in memory
+    for (EncodeStreamPtr& stream : m_streams) {
+        stream->buffer = std::make_unique<SamplesRingBuffer>(ENCODE_BLOCK_SIZE * format.audioChannelsNumber * ENCODE_BLOCKS_IN_BUFFER);
+        stream->thread = std::thread(&SoundTrackWriter::encode, this, stream.get(), format.audioChannelsNumber);
     }
 
-    if (m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data()) == 0) {
+    bool ok = render();
+
+    for (EncodeStreamPtr& stream : m_streams) {
+        stream->buffer->close();
+    }
+
+    for (EncodeStreamPtr& stream : m_streams) {
+        stream->thread.join();
+        ok = ok && stream->ok;
+    }
+
+    if (!ok) {
         return false;
     }
 
+    for (EncodeStreamPtr& stream : m_streams) {
+        stream->encoder->flush();
+    }
+
+    sendProgress(m_totalSamplesPerChannel, m_totalSamplesPerChannel);
+
     return true;
 }
 
@@ -100,6 +194,25 @@ framework::Progress SoundTrackWriter::progress()
     return m_progress;
 }
 
+SoundTrackWriter::EncodeStreamPtr SoundTrackWriter::createStream(TrackId trackId, const io::path_t& destination,
+                                                                 const SoundTrackFormat& format) const
+{
+    EncodeStreamPtr stream = std::make_unique<EncodeStream>();
+    stream->trackId = trackId;
+    stream->encoder = createEncoder(format.type);
+
+    if (!stream->encoder) {
+        return nullptr;
+    }
+
+    if (!stream->encoder->init(destination, format, m_totalSamplesPerChannel)) {
+        LOGE() << "Unable to write the sound track, path: " << destination;
+        return nullptr;
+    }
+
+    return stream;
+}
+
 encode::AbstractAudioEncoderPtr SoundTrackWriter::createEncoder(const SoundTrackType& type) const
 {
     switch (type) {
@@ -111,40 +224,81 @@ encode::AbstractAudioEncoderPtr SoundTrackWriter::createEncoder(const SoundTrack
     }
 }
 
-bool SoundTrackWriter::prepareInputBuffer()
+void SoundTrackWriter::encode(EncodeStream* stream, audioch_t audioChannels)
+{
+    std::vector<float> block(ENCODE_BLOCK_SIZE * audioChannels);
+
+    while (size_t count = stream->buffer->read(block.data(), block.size())) {
+        samples_t samplesPerChannel = count / audioChannels;
+        if (stream->encoder->encode(samplesPerChannel, block.data()) == 0) {
+            stream->ok = false;
+            stream->buffer->cancel();
+            break;
+        }
+
+        stream->encodedSamples += samplesPerChannel;
+    }
+}
+
+bool SoundTrackWriter::render()
 {
-    size_t inputBufferOffset = 0;
-    size_t inputBufferMaxOffset = m_inputBuffer.size();
+    const samples_t renderStep = config()->renderStep();
+    const samples_t chunkSize = RENDER_STEPS_IN_CHUNK * renderStep;
+    const audioch_t audioChannels = m_streams.front()->encoder->format().audioChannelsNumber;
 
-    sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+    samples_t renderedSamples = 0;
 
-    samples_t renderStep = config()->renderStep();
+    sendProgress(0, m_totalSamplesPerChannel);
 
-    while (inputBufferOffset < inputBufferMaxOffset) {
-        m_source->process(m_intermBuffer.data(), renderStep);
+    while (renderedSamples < m_totalSamplesPerChannel) {
+        //! NOTE The mixer still renders in steps of renderStep, so the result is the same as in real time
+        m_mixer->processChunk(m_renderBuffer.data(), chunkSize, renderStep);
 
-        size_t samplesToCopy = std::min(m_intermBuffer.size(), inputBufferMaxOffset - inputBufferOffset);
+        samples_t samplesToWrite = std::min(chunkSize, m_totalSamplesPerChannel - renderedSamples);
 
-        std::copy(m_intermBuffer.begin(),
-                  m_intermBuffer.begin() + samplesToCopy,
-                  m_inputBuffer.begin() + inputBufferOffset);
+        samples_t encodedSamples = m_totalSamplesPerChannel;
 
-        inputBufferOffset += samplesToCopy;
-        sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
-    }
+        for (EncodeStreamPtr& stream : m_streams) {
+            const float* input = streamInput(stream.get());
+            if (!input) {
+                LOGE() << "No output of the track: " << stream->trackId;
+                return false;
+            }
 
-    if (inputBufferOffset == 0) {
-        LOGI() << "No audio to export";
-        return false;
+            if (!stream->buffer->write(input, samplesToWrite * audioChannels)) {
+                return false;
+            }
+
+            encodedSamples = std::min(encodedSamples, stream->encodedSamples.load());
+        }
+
+        renderedSamples += samplesToWrite;
+
+        //! NOTE The encoders are at most a few blocks behind the render,
+        //! so the progress is the mean of both
+        sendProgress((renderedSamples + encodedSamples) / 2, m_totalSamplesPerChannel);
     }
 
     return true;
 }
 
-void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
+const float* SoundTrackWriter::streamInput(const EncodeStream* stream) const
 {
-    int stepRange = step == PREPARE_STEP ? 80 : 20;
-    int stepProgressStart = step == PREPARE_STEP ? 0 : 80;
-    int stepCurrentProgress = stepProgressStart + ((current * 100 / total) * stepRange) / 100;
-    m_progress.progressChanged.send(stepCurrentProgress, 100, "");
+    if (stream->trackId == -1) {
+        return m_renderBuffer.data();
+    }
+
+    //! NOTE The track output of the last chunk, before the master processing
+    return m_mixer->channelOutput(stream->trackId);
+}
+
+void SoundTrackWriter::sendProgress(int64_t current, int64_t total)
+{
+    int currentProgress = current * 100 / total;
+    if (currentProgress == m_lastProgress) {
+        return;
+    }
+
+    m_lastProgress = currentProgress;
+    m_progress.progressChanged.send(currentProgress, 100, "");
 }
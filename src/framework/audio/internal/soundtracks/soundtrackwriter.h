@@ -23,6 +23,11 @@
 #ifndef MU_AUDIO_SOUNDTRACKWRITER_H
 #define MU_AUDIO_SOUNDTRACKWRITER_H
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 #include <cstdio>
 
@@ -31,33 +36,60 @@
 
 #include "audio/iaudioconfiguration.h"
 #include "audiotypes.h"
-#include "iaudiosource.h"
 #include "internal/encoders/abstractaudioencoder.h"
+#include "internal/worker/mixer.h"
 
 namespace mu::audio::soundtrack {
+class SamplesRingBuffer;
 class SoundTrackWriter : public async::Asyncable
 {
     INJECT_STATIC(audio, IAudioConfiguration, config)
 public:
-    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, IAudioSourcePtr source);
+    //! NOTE Writes the master output to destination and, in the same render pass,
+    //! the output of every track of trackDestinations to its own file (stems)
+    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, MixerPtr mixer,
+                     const std::map<TrackId, io::path_t>& trackDestinations = {});
+    ~SoundTrackWriter();
 
     bool write();
     framework::Progress progress();
 
+    //! NOTE Returns "<destination>-<track name>.<suffix>" for every track. The empty and the repeated names
+    //! get the 1-based index of the track in the list appended, so no two stems end up in the same file
+    static std::map<TrackId, io::path_t> stemDestinations(const io::path_t& destination,
+                                                          const std::vector<std::pair<TrackId, TrackName> >& tracks);
+
 private:
+    struct EncodeStream {
+        TrackId trackId = -1; // -1 is the master output
+        encode::AbstractAudioEncoderPtr encoder = nullptr;
+        std::unique_ptr<SamplesRingBuffer> buffer = nullptr;
+        std::thread thread;
+        std::atomic<bool> ok = true;
+        std::atomic<samples_t> encodedSamples = 0;
+    };
+
+    using EncodeStreamPtr = std::unique_ptr<EncodeStream>;
+
+    EncodeStreamPtr createStream(TrackId trackId, const io::path_t& destination, const SoundTrackFormat& format) const;
     encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType& type) const;
-    bool prepareInputBuffer();
 
-    void sendStepProgress(int step, int64_t current, int64_t total);
+    void encode(EncodeStream* stream, audioch_t audioChannels);
+    bool render();
+    const float* streamInput(const EncodeStream* stream) const;
+
+    void sendProgress(int64_t current, int64_t total);
 
-    IAudioSourcePtr m_source = nullptr;
+    MixerPtr m_mixer = nullptr;
 
-    std::vector<float> m_inputBuffer;
-    std::vector<float> m_intermBuffer;
+    samples_t m_totalSamplesPerChannel = 0;
+    std::vector<float> m_renderBuffer;
 
-    encode::AbstractAudioEncoderPtr m_encoderPtr = nullptr;
+    //! NOTE The master output first
+    std::vector<EncodeStreamPtr> m_streams;
 
     framework::Progress m_progress;
+    int m_lastProgress = -1;
 };
 }
 
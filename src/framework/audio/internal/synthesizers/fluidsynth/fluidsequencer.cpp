@@ -47,7 +47,7 @@ void FluidSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes
 {
     m_offStreamEvents.clear();
     m_offStreamFlushed.notify();
-    updatePlaybackEvents(m_offStreamEvents, changes);
+    updatePlaybackEvents(m_offStreamEvents, changes.cbegin(), changes.cend());
     updateOffSequenceIterator();
 }
 
@@ -55,7 +55,15 @@ void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& change
 {
     m_mainStreamEvents.clear();
     m_mainStreamFlushed.notify();
-    updatePlaybackEvents(m_mainStreamEvents, changes);
+    updatePlaybackEvents(m_mainStreamEvents, changes.cbegin(), changes.cend());
+    updateMainSequenceIterator();
+}
+
+void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const msecs_t changedFrom, const msecs_t changedTo)
+{
+    m_mainStreamEvents.removeSources(changedFrom, changedTo);
+    m_mainStreamFlushed.notify();
+    updatePlaybackEvents(m_mainStreamEvents, events.lower_bound(changedFrom), events.upper_bound(changedTo));
     updateMainSequenceIterator();
 }
 
@@ -68,16 +76,20 @@ void FluidSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
         event.setIndex(midi::EXPRESSION_CONTROLLER);
         event.setData(expressionLevel(pair.second));
 
-        m_dynamicEvents[pair.first].emplace(std::move(event));
+        m_dynamicEvents.add(pair.first, std::move(event));
     }
 
+    m_dynamicEvents.commit();
     updateDynamicChangesIterator();
 }
 
-void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void FluidSequencer::updatePlaybackEvents(Timeline& destination, mpe::PlaybackEventsMap::const_iterator first,
+                                          mpe::PlaybackEventsMap::const_iterator last)
 {
-    for (const auto& pair : changes) {
-        for (const mpe::PlaybackEvent& event : pair.second) {
+    for (auto it = first; it != last; ++it) {
+        destination.setSourceTimestamp(it->first);
+
+        for (const mpe::PlaybackEvent& event : it->second) {
             if (!std::holds_alternative<mpe::NoteEvent>(event)) {
                 continue;
             }
@@ -98,22 +110,24 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
             noteOn.setVelocity(velocity);
             noteOn.setPitchNote(noteIdx, tuning);
 
-            destination[timestampFrom].emplace(std::move(noteOn));
+            destination.add(timestampFrom, std::move(noteOn));
 
             midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
             noteOff.setChannel(channelIdx);
             noteOff.setNote(noteIdx);
             noteOff.setPitchNote(noteIdx, tuning);
 
-            destination[timestampTo].emplace(std::move(noteOff));
+            destination.add(timestampTo, std::move(noteOff));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, 64);
             appendPitchBend(destination, noteEvent, BEND_SUPPORTED_TYPES, channelIdx);
         }
     }
+
+    destination.commit();
 }
 
-void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                          const mpe::ArticulationTypeSet& appliableTypes, const int midiControlIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -133,23 +147,23 @@ void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mp
         start.setIndex(midiControlIdx);
         start.setData(127);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(start));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(start));
 
         midi::Event end(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         end.setIndex(midiControlIdx);
         end.setData(0);
 
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(std::move(end));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, std::move(end));
     } else {
         midi::Event cc(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         cc.setIndex(midiControlIdx);
         cc.setData(0);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(cc));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(cc));
     }
 }
 
-void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendPitchBend(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                      const mpe::ArticulationTypeSet& appliableTypes, const channel_t channelIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -175,7 +189,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
                 timestamp_t currentPoint = timestampFrom + noteEvent.arrangementCtx().actualDuration * percentageToFactor(it->first);
 
                 event.setData(pitchBendLevel(it->second));
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
                 return;
             }
 
@@ -190,7 +204,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
 
                 int pitchBendVal = pitchBendLevel(it->second + (i * pitchStep));
                 event.setData(pitchBendVal);
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
             }
 
             it++;
@@ -200,7 +214,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
     }
 
     event.setData(8192);
-    destination[timestampFrom].emplace(std::move(event));
+    destination.add(timestampFrom, std::move(event));
 }
 
 channel_t FluidSequencer::channel(const mpe::NoteEvent& noteEvent) const
@@ -39,15 +39,17 @@ public:
 
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) override;
+    void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const msecs_t changedFrom, const msecs_t changedTo) override;
     void updateDynamicChanges(const mpe::DynamicLevelMap& changes) override;
 
 private:
-    void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes);
+    void updatePlaybackEvents(Timeline& destination, mpe::PlaybackEventsMap::const_iterator first,
+                              mpe::PlaybackEventsMap::const_iterator last);
 
-    void appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
+    void appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                              const int midiControlIdx);
 
-    void appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
+    void appendPitchBend(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                          const midi::channel_t channelIdx);
 
     midi::channel_t channel(const mpe::NoteEvent& noteEvent) const;
@@ -22,6 +22,8 @@
 
 #include "audiooutputhandler.h"
 
+#include <algorithm>
+
 #include "config.h"
 
 #include "log.h"
@@ -171,7 +173,19 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
 Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                  const SoundTrackFormat& format)
 {
-    return Promise<bool>([this, sequenceId, destination, format](auto resolve, auto reject) {
+    return doSaveSoundTrack(sequenceId, destination, format, {});
+}
+
+Promise<bool> AudioOutputHandler::saveSoundTrackStems(const TrackSequenceId sequenceId, const io::path_t& destination,
+                                                      const SoundTrackFormat& format, const TrackIdList& stemTrackIds)
+{
+    return doSaveSoundTrack(sequenceId, destination, format, stemTrackIds);
+}
+
+Promise<bool> AudioOutputHandler::doSaveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
+                                                   const SoundTrackFormat& format, const TrackIdList& stemTrackIds)
+{
+    return Promise<bool>([this, sequenceId, destination, format, stemTrackIds](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
@@ -184,10 +198,20 @@ Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceI
         }
 
 #ifdef ENABLE_AUDIO_EXPORT
+        std::vector<std::pair<TrackId, TrackName> > stemTracks;
+        const TrackIdList sequenceTrackIds = s->trackIdList();
+        for (const TrackId trackId : stemTrackIds) {
+            if (std::find(sequenceTrackIds.cbegin(), sequenceTrackIds.cend(), trackId) != sequenceTrackIds.cend()) {
+                stemTracks.push_back({ trackId, s->trackName(trackId) });
+            }
+        }
+
+        std::map<TrackId, io::path_t> trackDestinations = SoundTrackWriter::stemDestinations(destination, stemTracks);
+
         s->player()->stop();
         s->player()->seek(0);
         msecs_t totalDuration = s->player()->duration();
-        SoundTrackWriter writer(destination, format, totalDuration, mixer());
+        SoundTrackWriter writer(destination, format, totalDuration, mixer(), trackDestinations);
 
         framework::Progress progress = saveSoundTrackProgress(sequenceId);
         writer.progress().progressChanged.onReceive(this, [&progress](int64_t current, int64_t total, std::string title) {
@@ -199,6 +223,7 @@ Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceI
 
         return resolve(ok);
 #else
+        UNUSED(stemTrackIds);
         return reject(static_cast<int>(Err::DisabledAudioExport), "audio export is disabled");
 #endif
     }, AudioThread::ID);
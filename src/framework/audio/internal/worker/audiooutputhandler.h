@@ -54,6 +54,8 @@ public:
 
     async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                         const SoundTrackFormat& format) override;
+    async::Promise<bool> saveSoundTrackStems(const TrackSequenceId sequenceId, const io::path_t& destination,
+                                             const SoundTrackFormat& format, const TrackIdList& stemTrackIds) override;
 
     framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) override;
 
@@ -61,6 +63,8 @@ public:
 
 private:
     std::shared_ptr<Mixer> mixer() const;
+    async::Promise<bool> doSaveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
+                                          const SoundTrackFormat& format, const TrackIdList& stemTrackIds);
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
     void ensureSeqSubscriptions(const ITrackSequencePtr s) const;
     void ensureMixerSubscriptions() const;
@@ -26,11 +26,10 @@
 
 #include <limits>
 
-#include "concurrency/taskscheduler.h"
-
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiokernels.h"
 #include "audioerrors.h"
 
 using namespace mu;
@@ -40,6 +39,10 @@ using namespace mu::async;
 Mixer::Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    //! NOTE The audio worker thread processes channels too, so one thread less is needed
+    size_t threadCount = std::max(std::thread::hardware_concurrency() / 2, 1u) - 1;
+    m_threadPool = std::make_unique<MixerThreadPool>(threadCount);
 }
 
 Mixer::~Mixer()
@@ -70,6 +73,8 @@ RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, IAudioSourcePtr
     result.val = m_mixerChannels[trackId];
     result.ret = make_ret(Ret::Code::Ok);
 
+    updateChannelBuffers();
+
     return result;
 }
 
@@ -81,6 +86,7 @@ Ret Mixer::removeChannel(const TrackId id)
 
     if (search != m_mixerChannels.end() && search->second) {
         m_mixerChannels.erase(id);
+        updateChannelBuffers();
         return make_ret(Ret::Code::Ok);
     }
 
@@ -118,41 +124,59 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    for (IClockPtr clock : m_clocks) {
-        clock->forward((samplesPerChannel * 1000000) / m_sampleRate);
-    }
+    return processChunk(outBuffer, samplesPerChannel, samplesPerChannel);
+}
 
-    std::fill(outBuffer, outBuffer + samplesPerChannel * audioChannelsCount(), 0.f);
+samples_t Mixer::processChunk(float* outBuffer, samples_t samplesPerChannel, samples_t blockSize)
+{
+    ONLY_AUDIO_WORKER_THREAD;
 
-    if (m_writeCacheBuff.size() != samplesPerChannel * audioChannelsCount()) {
-        m_writeCacheBuff.resize(samplesPerChannel * audioChannelsCount(), 0.f);
+    IF_ASSERT_FAILED(blockSize > 0) {
+        return 0;
     }
 
-    samples_t masterChannelSampleCount = 0;
+    for (samples_t offset = 0; offset < samplesPerChannel; offset += blockSize) {
+        samples_t blockSamples = std::min(blockSize, samplesPerChannel - offset);
+        for (IClockPtr clock : m_clocks) {
+            clock->forward((blockSamples * 1000000) / m_sampleRate);
+        }
+    }
 
-    std::vector<std::future<std::vector<float> > > futureList;
+    //! NOTE Allocates only when the chunk size or the channels layout has changed
+    size_t channelBufferSize = samplesPerChannel * audioChannelsCount();
+    for (ChannelBuffer& buffer : m_channelBuffers) {
+        if (buffer.data.size() != channelBufferSize) {
+            buffer.data.resize(channelBufferSize);
+        }
+    }
 
-    for (const auto& pair : m_mixerChannels) {
-        MixerChannelPtr channel = pair.second;
-        std::future<std::vector<float> > future = TaskScheduler::instance()->submit([this, samplesPerChannel,
-                                                                                     channel]() -> std::vector<float> {
-            thread_local std::vector<float> buffer(samplesPerChannel * audioChannelsCount(), 0.f);
-            thread_local std::vector<float> silent_buffer(samplesPerChannel * audioChannelsCount(), 0.f);
+    //! NOTE Every channel renders the whole chunk block by block on its own thread,
+    //! so the threads are handed off once per chunk, not once per block
+    m_samplesToProcess = samplesPerChannel;
+    m_blockSize = blockSize;
+    m_threadPool->run(&Mixer::processChannel, this, m_channelBuffers.size());
+
+    //! NOTE The blocks are mixed in order with the same master processing as in real time,
+    //! so the result does not depend on the chunk size
+    samples_t processedSamplesCount = 0;
+    for (samples_t offset = 0; offset < samplesPerChannel; offset += blockSize) {
+        samples_t blockSamples = std::min(blockSize, samplesPerChannel - offset);
+        processedSamplesCount += mixBlock(outBuffer, offset, blockSamples);
+    }
 
-            buffer = silent_buffer;
+    return processedSamplesCount;
+}
 
-            if (channel) {
-                channel->process(buffer.data(), samplesPerChannel);
-            }
+samples_t Mixer::mixBlock(float* outBuffer, samples_t offset, samples_t samplesPerChannel)
+{
+    float* blockBuffer = outBuffer + offset * audioChannelsCount();
 
-            return buffer;
-        });
+    std::fill(blockBuffer, blockBuffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
-        futureList.emplace_back(std::move(future));
-    }
+    samples_t masterChannelSampleCount = 0;
 
-    for (size_t i = 0; i < futureList.size(); ++i) {
-        mixOutputFromChannel(outBuffer, futureList[i].get().data(), samplesPerChannel);
+    for (ChannelBuffer& buffer : m_channelBuffers) {
+        mixOutputFromChannel(blockBuffer, buffer.data.data() + offset * audioChannelsCount(), samplesPerChannel);
 
         masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
     }
@@ -164,17 +188,61 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    completeOutput(outBuffer, samplesPerChannel);
+    completeOutput(blockBuffer, samplesPerChannel);
 
     for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
         if (fxProcessor->active()) {
-            fxProcessor->process(outBuffer, samplesPerChannel);
+            fxProcessor->process(blockBuffer, samplesPerChannel);
         }
     }
 
     return masterChannelSampleCount;
 }
 
+const float* Mixer::channelOutput(const TrackId trackId) const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (const ChannelBuffer& buffer : m_channelBuffers) {
+        if (buffer.channel && buffer.channel->trackId() == trackId) {
+            return buffer.data.data();
+        }
+    }
+
+    return nullptr;
+}
+
+void Mixer::processChannel(void* mixer, size_t channelIndex)
+{
+    Mixer* self = static_cast<Mixer*>(mixer);
+    ChannelBuffer& buffer = self->m_channelBuffers[channelIndex];
+
+    std::fill(buffer.data.begin(), buffer.data.end(), 0.f);
+
+    if (!buffer.channel) {
+        return;
+    }
+
+    const samples_t samplesToProcess = self->m_samplesToProcess;
+    const samples_t blockSize = self->m_blockSize;
+    const audioch_t audioChannelsCount = self->m_audioChannelsCount;
+
+    for (samples_t offset = 0; offset < samplesToProcess; offset += blockSize) {
+        samples_t blockSamples = std::min(blockSize, samplesToProcess - offset);
+        buffer.channel->process(buffer.data.data() + offset * audioChannelsCount, blockSamples);
+    }
+}
+
+void Mixer::updateChannelBuffers()
+{
+    m_channelBuffers.resize(m_mixerChannels.size());
+
+    size_t idx = 0;
+    for (const auto& pair : m_mixerChannels) {
+        m_channelBuffers[idx++].channel = pair.second.get();
+    }
+}
+
 void Mixer::setIsActive(bool arg)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -271,13 +339,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::accumulateWithGain(outBuffer, inBuffer, samplesCount * audioChannelsCount(), 1.f);
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -286,25 +348,35 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
         return;
     }
 
-    float totalSquaredSum = 0.f;
+    float gains[dsp::MAX_KERNEL_AUDIO_CHANNELS] = {};
+    float squaredSums[dsp::MAX_KERNEL_AUDIO_CHANNELS] = {};
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    gain_t volumeGain = dsp::linearFromDecibels(m_masterParams.volume);
+    auto channelGain = [this, volumeGain](audioch_t audioChNum) {
+        return dsp::balanceGain(m_masterParams.balance, audioChNum) * volumeGain;
+    };
 
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+    //! NOTE The layouts with more channels than the kernel supports are processed channel by channel
+    bool useKernel = audioChannelsCount() <= dsp::MAX_KERNEL_AUDIO_CHANNELS;
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    if (useKernel) {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            gains[audioChNum] = channelGain(audioChNum);
+        }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        dsp::applyChannelGainsAndMeasure(buffer, audioChannelsCount(), samplesPerChannel, gains, squaredSums);
+    }
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+    float totalSquaredSum = 0.f;
+
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+        float squaredSum = useKernel
+                           ? squaredSums[audioChNum]
+                           : dsp::applyChannelGainAndMeasure(buffer, audioChannelsCount(), samplesPerChannel, audioChNum,
+                                                             channelGain(audioChNum));
+        totalSquaredSum += squaredSum;
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+        float rms = dsp::samplesRootMeanSquare(squaredSum, samplesPerChannel);
         notifyAboutAudioSignalChanges(audioChNum, rms);
     }
 
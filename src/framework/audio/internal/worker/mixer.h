@@ -30,6 +30,7 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "mixerthreadpool.h"
 #include "internal/dsp/limiter.h"
 #include "ifxresolver.h"
 #include "iclock.h"
@@ -64,12 +65,35 @@ public:
     samples_t process(float* outBuffer, samples_t samplesPerChannel) override;
     void setIsActive(bool arg) override;
 
+    //! NOTE Renders samplesPerChannel samples as consecutive blocks of blockSize.
+    //! Gives the same result as calling process() for every block, but every channel
+    //! renders all of its blocks in one go, which is what the offline render needs
+    samples_t processChunk(float* outBuffer, samples_t samplesPerChannel, samples_t blockSize);
+
+    //! NOTE The output of the channel in the last processed chunk, before the master processing.
+    //! Used to write the tracks to separate files in the same render pass
+    const float* channelOutput(const TrackId trackId) const;
+
 private:
+    struct ChannelBuffer {
+        MixerChannel* channel = nullptr;
+        std::vector<float> data;
+    };
+
+    static void processChannel(void* mixer, size_t channelIndex);
+
+    samples_t mixBlock(float* outBuffer, samples_t offset, samples_t samplesPerChannel);
+
+    void updateChannelBuffers();
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
-    std::vector<float> m_writeCacheBuff;
+    //! NOTE Preallocated output of every channel, in the order of m_mixerChannels
+    std::vector<ChannelBuffer> m_channelBuffers;
+    samples_t m_samplesToProcess = 0;
+    samples_t m_blockSize = 0;
+    std::unique_ptr<MixerThreadPool> m_threadPool;
 
     AudioOutputParams m_masterParams;
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
@@ -26,6 +26,7 @@
 #include "log.h"
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiokernels.h"
 #include "internal/audiosanitizer.h"
 
 using namespace mu;
@@ -43,6 +44,11 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     setSampleRate(sampleRate);
 }
 
+TrackId MixerChannel::trackId() const
+{
+    return m_trackId;
+}
+
 const AudioOutputParams& MixerChannel::outputParams() const
 {
     return m_params;
@@ -200,26 +206,35 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
 
 void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
 {
-    float totalSquaredSum = 0.f;
+    float gains[dsp::MAX_KERNEL_AUDIO_CHANNELS] = {};
+    float squaredSums[dsp::MAX_KERNEL_AUDIO_CHANNELS] = {};
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    gain_t volumeGain = dsp::linearFromDecibels(m_params.volume);
+    auto channelGain = [this, volumeGain](audioch_t audioChNum) {
+        return dsp::balanceGain(m_params.balance, audioChNum) * volumeGain;
+    };
 
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+    //! NOTE The layouts with more channels than the kernel supports are processed channel by channel
+    bool useKernel = audioChannelsCount() <= dsp::MAX_KERNEL_AUDIO_CHANNELS;
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    if (useKernel) {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            gains[audioChNum] = channelGain(audioChNum);
+        }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        dsp::applyChannelGainsAndMeasure(buffer, audioChannelsCount(), samplesCount, gains, squaredSums);
+    }
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
-        }
+    float totalSquaredSum = 0.f;
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+        float squaredSum = useKernel
+                           ? squaredSums[audioChNum]
+                           : dsp::applyChannelGainAndMeasure(buffer, audioChannelsCount(), samplesCount, audioChNum,
+                                                             channelGain(audioChNum));
+        totalSquaredSum += squaredSum;
 
+        float rms = dsp::samplesRootMeanSquare(squaredSum, samplesCount);
         notifyAboutAudioSignalChanges(audioChNum, rms);
     }
 
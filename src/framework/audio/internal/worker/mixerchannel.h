@@ -39,6 +39,8 @@ class MixerChannel : public ITrackAudioOutput, public async::Asyncable
 public:
     explicit MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate);
 
+    TrackId trackId() const;
+
     const AudioOutputParams& outputParams() const override;
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
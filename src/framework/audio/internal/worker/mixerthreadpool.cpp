@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mixerthreadpool.h"
+
+#include <chrono>
+
+#include "runtime.h"
+#include "log.h"
+
+#include "internal/audiosanitizer.h"
+
+using namespace mu::audio;
+
+static constexpr uint64_t INDEX_BITS = 32;
+static constexpr uint64_t INDEX_MASK = (uint64_t(1) << INDEX_BITS) - 1;
+
+//! NOTE After the last item a worker keeps polling for a while (the next audio block is usually
+//! only a few milliseconds away), then waits until the next job is published
+static constexpr int SPIN_COUNT = 64;
+static constexpr std::chrono::milliseconds BUSY_POLL_TIME(20);
+
+MixerThreadPool::MixerThreadPool(size_t threadCount)
+{
+    m_isActive = true;
+
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&MixerThreadPool::th_workerLoop, this);
+    }
+}
+
+MixerThreadPool::~MixerThreadPool()
+{
+    m_isActive = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeUpMutex);
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t MixerThreadPool::threadCount() const
+{
+    return m_threads.size();
+}
+
+void MixerThreadPool::run(Job job, void* context, size_t count)
+{
+    IF_ASSERT_FAILED(job && count <= INDEX_MASK) {
+        return;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    if (count == 1 || m_threads.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            job(context, i);
+        }
+        return;
+    }
+
+    //! NOTE No item of the previous job can be claimed anymore, so the job may be replaced
+    //! before the new state is published
+    m_job = job;
+    m_context = context;
+    m_doneCount.store(0, std::memory_order_relaxed);
+    m_state.store(uint64_t(count) << INDEX_BITS, std::memory_order_seq_cst);
+
+    //! NOTE The workers fall asleep only after an idle period, so the mutex is normally
+    //! not touched while the audio is playing
+    if (m_sleepingCount.load(std::memory_order_seq_cst) > 0) {
+        wakeUpWorkers();
+    }
+
+    while (runNextItem()) {
+    }
+
+    while (m_doneCount.load(std::memory_order_acquire) < count) {
+        std::this_thread::yield();
+    }
+}
+
+bool MixerThreadPool::runNextItem()
+{
+    uint64_t state = m_state.load(std::memory_order_acquire);
+
+    for (;;) {
+        uint64_t count = state >> INDEX_BITS;
+        uint64_t next = state & INDEX_MASK;
+
+        if (next >= count) {
+            return false;
+        }
+
+        //! NOTE The job is read only after a successful claim, which synchronizes with its publication
+        if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            m_job(m_context, static_cast<size_t>(next));
+            m_doneCount.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+bool MixerThreadPool::hasUnclaimedItems() const
+{
+    uint64_t state = m_state.load(std::memory_order_seq_cst);
+    return (state & INDEX_MASK) < (state >> INDEX_BITS);
+}
+
+void MixerThreadPool::wakeUpWorkers()
+{
+    //! NOTE Taking the mutex guarantees that a worker which has checked for work
+    //! is already waiting, so the notification isn't lost
+    {
+        std::lock_guard<std::mutex> lock(m_wakeUpMutex);
+    }
+    m_wakeUp.notify_all();
+}
+
+void MixerThreadPool::th_workerLoop()
+{
+    mu::runtime::setThreadName("audio_mixer");
+    AudioSanitizer::setupWorkerPoolThread();
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point lastWorkTime = Clock::now();
+    int spins = 0;
+
+    while (m_isActive.load(std::memory_order_relaxed)) {
+        if (runNextItem()) {
+            spins = 0;
+            lastWorkTime = Clock::now();
+            continue;
+        }
+
+        if (spins < SPIN_COUNT) {
+            ++spins;
+            continue;
+        }
+
+        if (Clock::now() - lastWorkTime < BUSY_POLL_TIME) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeUpMutex);
+        m_sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+        m_wakeUp.wait(lock, [this]() {
+            return !m_isActive.load() || hasUnclaimedItems();
+        });
+        m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+
+        spins = 0;
+        lastWorkTime = Clock::now();
+    }
+}
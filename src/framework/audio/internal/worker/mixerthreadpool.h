@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_MIXERTHREADPOOL_H
+#define MU_AUDIO_MIXERTHREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mu::audio {
+//! NOTE A fixed set of threads used by the mixer to process the channels in parallel.
+//! The work is published and claimed through atomics, so running a job from the audio callback
+//! doesn't allocate memory and locks a mutex only to wake up the threads after an idle period
+class MixerThreadPool
+{
+public:
+    using Job = void (*)(void* context, size_t index);
+
+    explicit MixerThreadPool(size_t threadCount);
+    ~MixerThreadPool();
+
+    size_t threadCount() const;
+
+    //! NOTE Calls job(context, i) for every i in [0, count) and returns when all calls are done.
+    //! The calling thread takes part in the work
+    void run(Job job, void* context, size_t count);
+
+private:
+    bool runNextItem();
+    bool hasUnclaimedItems() const;
+    void wakeUpWorkers();
+    void th_workerLoop();
+
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_isActive = false;
+
+    std::mutex m_wakeUpMutex;
+    std::condition_variable m_wakeUp;
+    std::atomic<size_t> m_sleepingCount = 0;
+
+    //! NOTE The items count in the high half and the next unclaimed index in the low half
+    std::atomic<uint64_t> m_state = 0;
+    std::atomic<size_t> m_doneCount = 0;
+
+    Job m_job = nullptr;
+    void* m_context = nullptr;
+};
+}
+
+#endif // MU_AUDIO_MIXERTHREADPOOL_H
@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "audio/internal/dsp/audiokernels.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+class Audio_AudioKernelsTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_initialSet = currentInstructionSet();
+    }
+
+    void TearDown() override
+    {
+        setInstructionSet(m_initialSet);
+    }
+
+    std::vector<float> randomSamples(size_t count)
+    {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+        std::vector<float> result(count);
+        for (float& sample : result) {
+            sample = distribution(m_generator);
+        }
+
+        return result;
+    }
+
+private:
+    InstructionSet m_initialSet = InstructionSet::Scalar;
+    std::mt19937 m_generator { 42 };
+};
+
+TEST_F(Audio_AudioKernelsTests, AllInstructionSets_SameAsScalar)
+{
+    //! [GIVEN] Buffers whose sizes are not multiples of the vector width
+    for (audioch_t audioChannelsCount : { 1, 2, 3, 4, 8 }) {
+        for (samples_t samplesPerChannel : { 0, 1, 7, 64, 513 }) {
+            size_t count = samplesPerChannel * audioChannelsCount;
+
+            std::vector<float> input = randomSamples(count);
+            std::vector<float> gains = randomSamples(audioChannelsCount);
+
+            //! [GIVEN] The results of the scalar kernels
+            setInstructionSet(InstructionSet::Scalar);
+
+            std::vector<float> expectedMix(count, 0.25f);
+            accumulateWithGain(expectedMix.data(), input.data(), count, 0.5f);
+            applyGain(expectedMix.data(), count, 0.75f);
+
+            std::vector<float> expectedBuffer = input;
+            std::vector<float> expectedSquaredSums(audioChannelsCount, 0.f);
+            applyChannelGainsAndMeasure(expectedBuffer.data(), audioChannelsCount, samplesPerChannel,
+                                        gains.data(), expectedSquaredSums.data());
+
+            for (InstructionSet set : availableInstructionSets()) {
+                SCOPED_TRACE(instructionSetName(set));
+
+                //! [WHEN] The same kernels are run with every available instruction set
+                setInstructionSet(set);
+
+                std::vector<float> mix(count, 0.25f);
+                accumulateWithGain(mix.data(), input.data(), count, 0.5f);
+                applyGain(mix.data(), count, 0.75f);
+
+                std::vector<float> buffer = input;
+                std::vector<float> squaredSums(audioChannelsCount, 0.f);
+                applyChannelGainsAndMeasure(buffer.data(), audioChannelsCount, samplesPerChannel,
+                                            gains.data(), squaredSums.data());
+
+                //! [THEN] The samples are exactly the same
+                EXPECT_EQ(mix, expectedMix);
+                EXPECT_EQ(buffer, expectedBuffer);
+
+                //! [THEN] The sums differ only by the summation order
+                for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+                    EXPECT_NEAR(squaredSums[audioChNum], expectedSquaredSums[audioChNum], 1e-4f * (1.f + expectedSquaredSums[audioChNum]));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(Audio_AudioKernelsTests, ApplyChannelGainsAndMeasure_Stereo)
+{
+    //! [GIVEN] Interleaved stereo buffer
+    std::vector<float> buffer = { 1.f, -1.f, 0.5f, -0.5f, 0.25f, 2.f };
+    const float gains[] = { 2.f, 0.5f };
+
+    for (InstructionSet set : availableInstructionSets()) {
+        SCOPED_TRACE(instructionSetName(set));
+        setInstructionSet(set);
+
+        //! [WHEN] Apply separate gains to the left and the right channels
+        std::vector<float> result = buffer;
+        float squaredSums[2] = { 0.f, 0.f };
+        applyChannelGainsAndMeasure(result.data(), 2, 3, gains, squaredSums);
+
+        //! [THEN] Every channel is multiplied by its own gain
+        EXPECT_EQ(result, std::vector<float>({ 2.f, -0.5f, 1.f, -0.25f, 0.5f, 1.f }));
+
+        //! [THEN] The squared sums are calculated per channel
+        EXPECT_FLOAT_EQ(squaredSums[0], 4.f + 1.f + 0.25f);
+        EXPECT_FLOAT_EQ(squaredSums[1], 0.25f + 0.0625f + 1.f);
+    }
+}
+
+TEST_F(Audio_AudioKernelsTests, ApplyChannelGainAndMeasure_SameAsKernel)
+{
+    //! [GIVEN] Interleaved buffer with a few channels
+    const audioch_t audioChannelsCount = 3;
+    const samples_t samplesPerChannel = 65;
+
+    std::vector<float> input = randomSamples(samplesPerChannel * audioChannelsCount);
+    std::vector<float> gains = randomSamples(audioChannelsCount);
+
+    std::vector<float> expectedBuffer = input;
+    std::vector<float> expectedSquaredSums(audioChannelsCount, 0.f);
+    applyChannelGainsAndMeasure(expectedBuffer.data(), audioChannelsCount, samplesPerChannel,
+                                gains.data(), expectedSquaredSums.data());
+
+    //! [WHEN] Apply the gains channel by channel
+    std::vector<float> buffer = input;
+    std::vector<float> squaredSums;
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+        squaredSums.push_back(applyChannelGainAndMeasure(buffer.data(), audioChannelsCount, samplesPerChannel,
+                                                         audioChNum, gains[audioChNum]));
+    }
+
+    //! [THEN] The result is the same as the one of the kernel
+    EXPECT_EQ(buffer, expectedBuffer);
+
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+        EXPECT_NEAR(squaredSums[audioChNum], expectedSquaredSums[audioChNum], 1e-4f * (1.f + expectedSquaredSums[audioChNum]));
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "audio/internal/dsp/audiokernels.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+//! NOTE Measures the time of the DSP kernels for every instruction set available on the machine.
+//! Run with --gtest_filter=Audio_AudioKernelsBenchmark.* to see the results
+class Audio_AudioKernelsBenchmark : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_initialSet = currentInstructionSet();
+    }
+
+    void TearDown() override
+    {
+        setInstructionSet(m_initialSet);
+    }
+
+private:
+    InstructionSet m_initialSet = InstructionSet::Scalar;
+};
+
+TEST_F(Audio_AudioKernelsBenchmark, KernelTimeByInstructionSet)
+{
+    constexpr audioch_t AUDIO_CHANNELS = 2;
+    constexpr int WARMUP_RUNS = 100;
+    constexpr int MEASURED_RUNS = 2000;
+
+    std::cout << std::setw(28) << "kernel" << std::setw(8) << "set" << std::setw(8) << "block"
+              << std::setw(12) << "mean, ns" << std::setw(12) << "p99, ns" << std::endl;
+
+    for (samples_t blockSize : { 64, 256, 1024 }) {
+        size_t count = blockSize * AUDIO_CHANNELS;
+
+        std::vector<float> input(count, 0.5f);
+        std::vector<float> buffer(count, 0.5f);
+        const float gains[AUDIO_CHANNELS] = { 0.999f, 1.001f };
+        float squaredSums[AUDIO_CHANNELS] = { 0.f, 0.f };
+
+        const std::vector<std::pair<const char*, std::function<void()> > > kernels = {
+            { "accumulateWithGain", [&]() { accumulateWithGain(buffer.data(), input.data(), count, 0.999f); } },
+            { "applyGain", [&]() { applyGain(buffer.data(), count, 0.999f); } },
+            { "applyChannelGainsAndMeasure", [&]() {
+                  applyChannelGainsAndMeasure(buffer.data(), AUDIO_CHANNELS, blockSize, gains, squaredSums);
+              } },
+        };
+
+        for (const auto& kernel : kernels) {
+            for (InstructionSet set : availableInstructionSets()) {
+                setInstructionSet(set);
+                std::fill(buffer.begin(), buffer.end(), 0.5f);
+
+                std::vector<double> times;
+                times.reserve(MEASURED_RUNS);
+
+                for (int run = 0; run < WARMUP_RUNS + MEASURED_RUNS; ++run) {
+                    auto start = std::chrono::steady_clock::now();
+                    kernel.second();
+                    auto end = std::chrono::steady_clock::now();
+
+                    if (run >= WARMUP_RUNS) {
+                        times.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+                    }
+                }
+
+                std::sort(times.begin(), times.end());
+
+                double mean = 0;
+                for (double time : times) {
+                    mean += time;
+                }
+                mean /= times.size();
+
+                std::cout << std::setw(28) << kernel.first << std::setw(8) << instructionSetName(set) << std::setw(8) << blockSize
+                          << std::fixed << std::setprecision(1)
+                          << std::setw(12) << mean
+                          << std::setw(12) << times[times.size() * 99 / 100] << std::endl;
+            }
+        }
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/eventtimeline.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+class Audio_EventTimelineTests : public ::testing::Test
+{
+public:
+    using Timeline = EventTimeline<int>;
+
+    std::vector<int> events(const Timeline& timeline) const
+    {
+        std::vector<int> result;
+        for (const Timeline::Entry& entry : timeline) {
+            result.push_back(entry.event);
+        }
+
+        return result;
+    }
+
+    std::vector<msecs_t> timestamps(const Timeline& timeline) const
+    {
+        std::vector<msecs_t> result;
+        for (const Timeline::Entry& entry : timeline) {
+            result.push_back(entry.timestamp);
+        }
+
+        return result;
+    }
+};
+
+/**
+ * @brief Events added in an arbitrary order are sorted by time after commit,
+ *        equal events at the same time produced by the same source are kept only once
+ */
+TEST_F(Audio_EventTimelineTests, Commit_SortsAndRemovesDuplicates)
+{
+    //! [GIVEN] Unsorted events with a duplicate
+    Timeline timeline;
+    timeline.setSourceTimestamp(0);
+    timeline.add(200, 3);
+    timeline.add(0, 2);
+    timeline.add(0, 1);
+    timeline.add(200, 3);
+
+    //! [WHEN] Commit them
+    timeline.commit();
+
+    //! [THEN] The events are sorted by time, then by value, and the duplicate is gone
+    EXPECT_EQ(events(timeline), std::vector<int>({ 1, 2, 3 }));
+    EXPECT_EQ(timestamps(timeline), std::vector<msecs_t>({ 0, 0, 200 }));
+}
+
+/**
+ * @brief Events committed later are merged into the already sorted timeline
+ */
+TEST_F(Audio_EventTimelineTests, Commit_MergesIntoExistingEvents)
+{
+    //! [GIVEN] The timeline with committed events
+    Timeline timeline;
+    timeline.setSourceTimestamp(0);
+    timeline.add(0, 1);
+    timeline.add(300, 4);
+    timeline.commit();
+
+    //! [WHEN] Add and commit events of another source in between
+    timeline.setSourceTimestamp(100);
+    timeline.add(100, 2);
+    timeline.add(200, 3);
+    timeline.commit();
+
+    //! [THEN] All events are sorted by time
+    EXPECT_EQ(events(timeline), std::vector<int>({ 1, 2, 3, 4 }));
+    EXPECT_EQ(timestamps(timeline), std::vector<msecs_t>({ 0, 100, 200, 300 }));
+}
+
+/**
+ * @brief Only the events produced by the sources from the given range are removed,
+ *        even if they overlap the events of other sources in time
+ */
+TEST_F(Audio_EventTimelineTests, RemoveSources)
+{
+    //! [GIVEN] Three sources, the second one produces an event after the third one
+    Timeline timeline;
+    timeline.setSourceTimestamp(0);
+    timeline.add(0, 1);
+    timeline.add(100, 2);
+
+    timeline.setSourceTimestamp(100);
+    timeline.add(100, 3);
+    timeline.add(500, 4);
+
+    timeline.setSourceTimestamp(200);
+    timeline.add(200, 5);
+    timeline.add(300, 6);
+    timeline.commit();
+
+    //! [WHEN] Remove the events of the second source
+    timeline.removeSources(50, 150);
+
+    //! [THEN] The events of the other sources are kept in order
+    EXPECT_EQ(events(timeline), std::vector<int>({ 1, 2, 5, 6 }));
+    EXPECT_EQ(timestamps(timeline), std::vector<msecs_t>({ 0, 100, 200, 300 }));
+}
+
+/**
+ * @brief lowerBound returns the first event which isn't earlier than the given time
+ */
+TEST_F(Audio_EventTimelineTests, LowerBound)
+{
+    //! [GIVEN] The timeline with events at 0, 100 and 200 ms
+    Timeline timeline;
+    timeline.add(0, 1);
+    timeline.add(100, 2);
+    timeline.add(200, 3);
+    timeline.commit();
+
+    //! [THEN] The lower bound is found for every position
+    EXPECT_EQ(timeline.lowerBound(0)->event, 1);
+    EXPECT_EQ(timeline.lowerBound(50)->event, 2);
+    EXPECT_EQ(timeline.lowerBound(100)->event, 2);
+    EXPECT_EQ(timeline.lowerBound(200)->event, 3);
+    EXPECT_TRUE(timeline.lowerBound(201) == timeline.end());
+}
+
+/**
+ * @brief Equal events at the same time are taken once, also if they are produced by different sources,
+ *        and the remaining source still produces the event after the other one is removed
+ */
+TEST_F(Audio_EventTimelineTests, Take_SkipsEqualEventsOfDifferentSources)
+{
+    //! [GIVEN] Two sources produce the same event at 100 ms
+    Timeline timeline;
+    timeline.setSourceTimestamp(0);
+    timeline.add(0, 1);
+    timeline.add(100, 2);
+
+    timeline.setSourceTimestamp(100);
+    timeline.add(100, 2);
+    timeline.add(200, 3);
+    timeline.commit();
+
+    //! [WHEN] Take the events up to 100 ms, then the rest
+    std::vector<int> taken;
+    Timeline::const_iterator it = timeline.begin();
+    Timeline::take(taken, it, timeline.end(), 100);
+
+    //! [THEN] The same event is taken once
+    EXPECT_EQ(taken, std::vector<int>({ 1, 2 }));
+
+    Timeline::take(taken, it, timeline.end(), 1000);
+    EXPECT_EQ(taken, std::vector<int>({ 1, 2, 3 }));
+    EXPECT_TRUE(it == timeline.end());
+
+    //! [WHEN] Remove the first source and take all events again
+    timeline.removeSources(0, 0);
+
+    taken.clear();
+    it = timeline.begin();
+    Timeline::take(taken, it, timeline.end(), 1000);
+
+    //! [THEN] The event of the second source is still there
+    EXPECT_EQ(taken, std::vector<int>({ 2, 3 }));
+}
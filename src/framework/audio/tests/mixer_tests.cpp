@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/internal/audiosanitizer.h"
+#include "audio/internal/worker/mixer.h"
+#include "audio/internal/worker/sinesource.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+class Audio_MixerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+
+    MixerPtr makeMixer(TrackId channelsCount) const
+    {
+        MixerPtr mixer = std::make_shared<Mixer>();
+        mixer->setSampleRate(SAMPLE_RATE);
+        mixer->setAudioChannelsCount(AUDIO_CHANNELS);
+
+        for (TrackId trackId = 0; trackId < channelsCount; ++trackId) {
+            IAudioSourcePtr source = std::make_shared<SineSource>();
+            EXPECT_TRUE(mixer->addChannel(trackId, source).ret);
+        }
+
+        mixer->setIsActive(true);
+
+        return mixer;
+    }
+
+    static constexpr unsigned int SAMPLE_RATE = 48000;
+    static constexpr audioch_t AUDIO_CHANNELS = 2;
+};
+
+TEST_F(Audio_MixerTests, ProcessChunk_SameAsProcessByBlocks)
+{
+    constexpr samples_t BLOCK_SIZE = 512;
+    constexpr samples_t CHUNK_SIZE = BLOCK_SIZE * 16;
+    constexpr int CHUNKS = 4;
+
+    //! [GIVEN] Two mixers with the same channels
+    MixerPtr blockMixer = makeMixer(8);
+    MixerPtr chunkMixer = makeMixer(8);
+
+    //! [WHEN] One renders block by block and the other in chunks of many blocks
+    std::vector<float> blockOutput(CHUNK_SIZE * CHUNKS * AUDIO_CHANNELS);
+    for (samples_t offset = 0; offset < CHUNK_SIZE * CHUNKS; offset += BLOCK_SIZE) {
+        blockMixer->process(blockOutput.data() + offset * AUDIO_CHANNELS, BLOCK_SIZE);
+    }
+
+    std::vector<float> chunkOutput(CHUNK_SIZE * CHUNKS * AUDIO_CHANNELS);
+    for (int chunk = 0; chunk < CHUNKS; ++chunk) {
+        samples_t processed = chunkMixer->processChunk(chunkOutput.data() + chunk * CHUNK_SIZE * AUDIO_CHANNELS, CHUNK_SIZE,
+                                                       BLOCK_SIZE);
+        EXPECT_EQ(processed, CHUNK_SIZE);
+    }
+
+    //! [THEN] The outputs are bit-identical
+    EXPECT_EQ(blockOutput, chunkOutput);
+}
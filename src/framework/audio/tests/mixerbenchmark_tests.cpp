@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "audio/internal/audiosanitizer.h"
+#include "audio/internal/worker/mixer.h"
+#include "audio/internal/worker/sinesource.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+//! NOTE Measures the time of Mixer::process (one audio callback) depending on the channels count.
+//! Run with --gtest_filter=Audio_MixerBenchmark.* to see the results
+class Audio_MixerBenchmark : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+};
+
+TEST_F(Audio_MixerBenchmark, ProcessTimeByChannelsCount)
+{
+    constexpr unsigned int SAMPLE_RATE = 48000;
+    constexpr audioch_t AUDIO_CHANNELS = 2;
+    constexpr int WARMUP_BLOCKS = 20;
+    constexpr int MEASURED_BLOCKS = 200;
+
+    std::cout << std::setw(10) << "channels" << std::setw(8) << "block"
+              << std::setw(12) << "mean, us" << std::setw(12) << "p99, us" << std::setw(12) << "max, us" << std::endl;
+
+    for (samples_t blockSize : { 64, 256 }) {
+        for (TrackId channelsCount : { 1, 8, 16, 32, 64, 128 }) {
+            MixerPtr mixer = std::make_shared<Mixer>();
+            mixer->setSampleRate(SAMPLE_RATE);
+            mixer->setAudioChannelsCount(AUDIO_CHANNELS);
+
+            for (TrackId trackId = 0; trackId < channelsCount; ++trackId) {
+                IAudioSourcePtr source = std::make_shared<SineSource>();
+                ASSERT_TRUE(mixer->addChannel(trackId, source).ret);
+            }
+
+            std::vector<float> output(blockSize * AUDIO_CHANNELS, 0.f);
+            std::vector<double> times;
+            times.reserve(MEASURED_BLOCKS);
+
+            for (int block = 0; block < WARMUP_BLOCKS + MEASURED_BLOCKS; ++block) {
+                auto start = std::chrono::steady_clock::now();
+                samples_t processed = mixer->process(output.data(), blockSize);
+                auto end = std::chrono::steady_clock::now();
+
+                ASSERT_EQ(processed, blockSize);
+
+                if (block >= WARMUP_BLOCKS) {
+                    times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+                }
+            }
+
+            std::sort(times.begin(), times.end());
+
+            double mean = 0;
+            for (double time : times) {
+                mean += time;
+            }
+            mean /= times.size();
+
+            std::cout << std::setw(10) << channelsCount << std::setw(8) << blockSize
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(12) << mean
+                      << std::setw(12) << times[times.size() * 99 / 100]
+                      << std::setw(12) << times.back() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "audio/internal/worker/mixerthreadpool.h"
+
+using namespace mu::audio;
+
+class Audio_MixerThreadPoolTests : public ::testing::Test
+{
+public:
+};
+
+namespace {
+struct Counters {
+    std::vector<std::atomic<int> > calls;
+    explicit Counters(size_t size)
+        : calls(size) {}
+};
+
+void countCall(void* context, size_t index)
+{
+    static_cast<Counters*>(context)->calls[index].fetch_add(1);
+}
+}
+
+TEST_F(Audio_MixerThreadPoolTests, EveryItemRunsOnce)
+{
+    //! GIVEN Pool with several threads
+    MixerThreadPool pool(3);
+    EXPECT_EQ(pool.threadCount(), 3);
+
+    //! DO Run many jobs of different sizes one after another
+    for (size_t count : { 0, 1, 2, 7, 64, 200 }) {
+        for (int round = 0; round < 500; ++round) {
+            Counters counters(count);
+            pool.run(&countCall, &counters, count);
+
+            //! CHECK Every item was processed exactly once before run returned
+            for (size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(counters.calls[i].load(), 1) << "count: " << count << ", index: " << i;
+            }
+        }
+    }
+}
+
+TEST_F(Audio_MixerThreadPoolTests, NoThreads)
+{
+    //! GIVEN Pool without threads
+    MixerThreadPool pool(0);
+
+    //! DO Run a job
+    Counters counters(10);
+    pool.run(&countCall, &counters, 10);
+
+    //! CHECK The calling thread did all the work
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(counters.calls[i].load(), 1);
+    }
+}
+
+TEST_F(Audio_MixerThreadPoolTests, RunAfterIdle)
+{
+    //! GIVEN Pool whose threads have been idle long enough to wait for the next job
+    MixerThreadPool pool(3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for (int round = 0; round < 3; ++round) {
+        //! DO Run a job
+        Counters counters(64);
+        pool.run(&countCall, &counters, 64);
+
+        //! CHECK Every item was processed exactly once
+        for (size_t i = 0; i < 64; ++i) {
+            ASSERT_EQ(counters.calls[i].load(), 1) << "round: " << round << ", index: " << i;
+        }
+
+        //! DO Let the threads fall asleep again
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "audio/internal/soundtracks/samplesringbuffer.h"
+
+using namespace mu::audio::soundtrack;
+
+class Audio_SamplesRingBufferTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Audio_SamplesRingBufferTests, PassesAllSamplesInOrder)
+{
+    //! [GIVEN] A buffer much smaller than the stream
+    SamplesRingBuffer buffer(64);
+
+    constexpr size_t TOTAL = 10000;
+    std::vector<float> input(TOTAL);
+    for (size_t i = 0; i < TOTAL; ++i) {
+        input[i] = static_cast<float>(i);
+    }
+
+    //! [WHEN] The samples are written in blocks of one size and read in blocks of another size
+    std::thread writer([&buffer, &input]() {
+        for (size_t i = 0; i < input.size(); i += 37) {
+            EXPECT_TRUE(buffer.write(input.data() + i, std::min<size_t>(37, input.size() - i)));
+        }
+        buffer.close();
+    });
+
+    std::vector<float> output;
+    std::vector<float> block(50);
+    while (size_t count = buffer.read(block.data(), block.size())) {
+        output.insert(output.end(), block.begin(), block.begin() + count);
+    }
+
+    writer.join();
+
+    //! [THEN] The reader gets all the samples in the same order
+    EXPECT_EQ(output, input);
+}
+
+TEST_F(Audio_SamplesRingBufferTests, CancelReleasesWriter)
+{
+    //! [GIVEN] A full buffer
+    SamplesRingBuffer buffer(8);
+    std::vector<float> input(32, 1.f);
+
+    //! [WHEN] The writer waits for space and the buffer is cancelled
+    bool written = true;
+    std::thread writer([&buffer, &input, &written]() {
+        written = buffer.write(input.data(), input.size());
+    });
+
+    buffer.cancel();
+    writer.join();
+
+    //! [THEN] The write fails and nothing can be read
+    EXPECT_FALSE(written);
+    EXPECT_EQ(buffer.read(input.data(), input.size()), 0u);
+}
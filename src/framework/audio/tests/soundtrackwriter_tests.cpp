@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "audio/internal/soundtracks/soundtrackwriter.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::soundtrack;
+
+class Audio_SoundTrackWriterTests : public ::testing::Test
+{
+public:
+    using Tracks = std::vector<std::pair<TrackId, TrackName> >;
+};
+
+TEST_F(Audio_SoundTrackWriterTests, StemDestinations)
+{
+    //! [GIVEN] Tracks with unique names
+    Tracks tracks = { { 0, "Flute" }, { 1, "Grand Piano" } };
+
+    //! [WHEN] Get the stem destinations
+    std::map<TrackId, io::path_t> destinations = SoundTrackWriter::stemDestinations("/tmp/score.wav", tracks);
+
+    //! [THEN] Every track is written next to the master file, under its own name
+    ASSERT_EQ(destinations.size(), 2);
+    EXPECT_EQ(destinations.at(0), io::path_t("/tmp/score-Flute.wav"));
+    EXPECT_EQ(destinations.at(1), io::path_t("/tmp/score-Grand_Piano.wav"));
+}
+
+TEST_F(Audio_SoundTrackWriterTests, StemDestinationsOfPartsWithTheSameName)
+{
+    //! [GIVEN] Two parts with the same name, a part without a name
+    //!         and a part, whose name looks like a numbered one
+    Tracks tracks = { { 3, "Piano" }, { 5, "piano" }, { 7, "" }, { 8, "Piano-2" } };
+
+    //! [WHEN] Get the stem destinations
+    std::map<TrackId, io::path_t> destinations = SoundTrackWriter::stemDestinations("/tmp/score.mp3", tracks);
+
+    //! [THEN] The repeated and the empty names get the index of the track
+    ASSERT_EQ(destinations.size(), 4);
+    EXPECT_EQ(destinations.at(3), io::path_t("/tmp/score-Piano-1.mp3"));
+    EXPECT_EQ(destinations.at(7), io::path_t("/tmp/score-track-3.mp3"));
+
+    //! [THEN] The unique name is kept and the repeated one doesn't take it
+    EXPECT_EQ(destinations.at(8), io::path_t("/tmp/score-Piano-2.mp3"));
+    EXPECT_NE(destinations.at(5), destinations.at(8));
+
+    //! [THEN] No two stems are written to the same file, even on a case insensitive file system
+    std::set<std::string> files;
+    for (const auto& pair : destinations) {
+        EXPECT_TRUE(files.insert(pair.second.toString().toLower().toStdString()).second);
+    }
+}
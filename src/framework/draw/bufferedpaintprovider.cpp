@@ -174,10 +174,18 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    //! NOTE Painter does not send the restored state to the provider, so we should restore it ourselves
+    if (m_savedStates.empty()) {
+        return;
+    }
+
+    editableState() = m_savedStates.top();
+    m_savedStates.pop();
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -188,6 +196,12 @@ void BufferedPaintProvider::setTransform(const Transform& transform)
 
 const Transform& BufferedPaintProvider::transform() const
 {
+    //! NOTE Painter asks for the transform before the target is begun
+    if (m_currentObjects.empty()) {
+        static const Transform identity;
+        return identity;
+    }
+
     return currentState().transform;
 }
 
@@ -226,8 +240,10 @@ void BufferedPaintProvider::drawText(const RectF& rect, int flags, const String&
 
 void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
 {
+    save();
     setFont(f);
     drawText(pos, text);
+    restore();
 }
 
 void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
@@ -278,4 +294,6 @@ void BufferedPaintProvider::clear()
     m_buf = DrawData();
     std::stack<DrawData::Object> empty;
     m_currentObjects.swap(empty);
+    std::stack<DrawData::State> emptyStates;
+    m_savedStates.swap(emptyStates);
 }
@@ -101,6 +101,7 @@ private:
 
     DrawData m_buf;
     std::stack<DrawData::Object> m_currentObjects;
+    std::stack<DrawData::State> m_savedStates;
     bool m_isActive = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
 };
@@ -0,0 +1,245 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fontmetricscache.h"
+
+#include <functional>
+
+using namespace mu;
+using namespace mu::draw;
+
+//! NOTE Protects from the unbounded growth when a lot of different strings are measured,
+//! the cache is dropped and filled again after the limit is reached
+static constexpr size_t MAX_CACHED_ENTRIES = 10000;
+
+static void hashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+double FontMetricsCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+bool FontMetricsCache::FontKey::operator==(const FontKey& other) const
+{
+    return family == other.family
+           && pointSize == other.pointSize
+           && pixelSize == other.pixelSize
+           && weight == other.weight
+           && style == other.style
+           && noFontMerging == other.noFontMerging
+           && hinting == other.hinting;
+}
+
+size_t FontMetricsCache::FontKeyHash::operator()(const FontKey& key) const
+{
+    size_t seed = key.family.hash();
+    hashCombine(seed, std::hash<double> {}(key.pointSize));
+    hashCombine(seed, std::hash<int> {}(key.pixelSize));
+    hashCombine(seed, std::hash<int> {}(key.weight));
+    hashCombine(seed, std::hash<int> {}(key.style));
+    hashCombine(seed, std::hash<bool> {}(key.noFontMerging));
+    hashCombine(seed, std::hash<int> {}(key.hinting));
+
+    return seed;
+}
+
+FontMetricsCache::FontData::FontData(const QFont& font, QPaintDevice* device)
+    : metrics(font, device)
+{
+    lineSpacing = metrics.lineSpacing();
+    xHeight = metrics.xHeight();
+    height = metrics.height();
+    ascent = metrics.ascent();
+    descent = metrics.descent();
+}
+
+FontMetricsCache::FontMetricsCache(QPaintDevice* device)
+    : m_device(device)
+{
+}
+
+double FontMetricsCache::lineSpacing(const Font& f) const
+{
+    std::lock_guard lock(m_mutex);
+    return fontData(f).lineSpacing;
+}
+
+double FontMetricsCache::xHeight(const Font& f) const
+{
+    std::lock_guard lock(m_mutex);
+    return fontData(f).xHeight;
+}
+
+double FontMetricsCache::height(const Font& f) const
+{
+    std::lock_guard lock(m_mutex);
+    return fontData(f).height;
+}
+
+double FontMetricsCache::ascent(const Font& f) const
+{
+    std::lock_guard lock(m_mutex);
+    return fontData(f).ascent;
+}
+
+double FontMetricsCache::descent(const Font& f) const
+{
+    std::lock_guard lock(m_mutex);
+    return fontData(f).descent;
+}
+
+bool FontMetricsCache::inFont(const Font& f, Char ch) const
+{
+    return inFontUcs4(f, ch.unicode());
+}
+
+bool FontMetricsCache::inFontUcs4(const Font& f, char32_t ucs4) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.glyphsInFont, ucs4, [&data, ucs4]() {
+        return data.metrics.inFontUcs4(ucs4);
+    });
+}
+
+double FontMetricsCache::horizontalAdvance(const Font& f, const String& string) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.stringAdvances, string, [&data, &string]() {
+        return data.metrics.horizontalAdvance(string);
+    });
+}
+
+double FontMetricsCache::horizontalAdvance(const Font& f, const Char& ch) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.glyphAdvances, ch.unicode(), [&data, ch]() {
+        return data.metrics.horizontalAdvance(ch);
+    });
+}
+
+RectF FontMetricsCache::boundingRect(const Font& f, const String& string) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.stringBoundingRects, string, [&data, &string]() {
+        return RectF::fromQRectF(data.metrics.boundingRect(string));
+    });
+}
+
+RectF FontMetricsCache::boundingRect(const Font& f, const Char& ch) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.glyphBoundingRects, ch.unicode(), [&data, ch]() {
+        return RectF::fromQRectF(data.metrics.boundingRect(ch));
+    });
+}
+
+RectF FontMetricsCache::tightBoundingRect(const Font& f, const String& string) const
+{
+    std::lock_guard lock(m_mutex);
+    FontData& data = fontData(f);
+
+    return cached(data.stringTightBoundingRects, string, [&data, &string]() {
+        return RectF::fromQRectF(data.metrics.tightBoundingRect(string));
+    });
+}
+
+void FontMetricsCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_fonts.clear();
+}
+
+FontMetricsCache::Stats FontMetricsCache::stats() const
+{
+    Stats result;
+    result.hits = m_hits;
+    result.misses = m_misses;
+
+    return result;
+}
+
+void FontMetricsCache::resetStats()
+{
+    m_hits = 0;
+    m_misses = 0;
+}
+
+FontMetricsCache::FontKey FontMetricsCache::fontKey(const Font& f)
+{
+    FontKey key;
+    key.family = f.family();
+    key.pointSize = f.pointSizeF();
+    key.pixelSize = f.pixelSize();
+    key.weight = static_cast<int>(f.weight());
+    key.style = (f.bold() ? 1 : 0) | (f.italic() ? 2 : 0) | (f.underline() ? 4 : 0) | (f.strike() ? 8 : 0);
+    key.noFontMerging = f.noFontMerging();
+    key.hinting = static_cast<int>(f.hinting());
+
+    return key;
+}
+
+FontMetricsCache::FontData& FontMetricsCache::fontData(const Font& f) const
+{
+    FontKey key = fontKey(f);
+
+    auto it = m_fonts.find(key);
+    if (it != m_fonts.end()) {
+        return *it->second;
+    }
+
+    auto data = std::make_unique<FontData>(f.toQFont(), m_device);
+    return *m_fonts.emplace(std::move(key), std::move(data)).first->second;
+}
+
+template<typename Key, typename Value, typename Hash, typename Measure>
+Value FontMetricsCache::cached(std::unordered_map<Key, Value, Hash>& cache, const Key& key, Measure measure) const
+{
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        ++m_hits;
+        return it->second;
+    }
+
+    ++m_misses;
+
+    if (cache.size() >= MAX_CACHED_ENTRIES) {
+        cache.clear();
+    }
+
+    Value value = measure();
+    cache.emplace(key, value);
+
+    return value;
+}
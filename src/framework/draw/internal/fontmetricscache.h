@@ -0,0 +1,136 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_FONTMETRICSCACHE_H
+#define MU_DRAW_FONTMETRICSCACHE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <QFontMetricsF>
+
+#include "types/font.h"
+#include "types/geometry.h"
+#include "types/string.h"
+
+class QPaintDevice;
+
+namespace mu::draw {
+//! NOTE Caches the results of QFontMetricsF per font, so that
+//! the metrics object isn't built again for every measured text fragment.
+//! Font-wide metrics are computed once per font, glyphs and strings are measured once per font.
+//! Can be used from several threads
+class FontMetricsCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        double hitRate() const;
+    };
+
+    explicit FontMetricsCache(QPaintDevice* device);
+
+    double lineSpacing(const Font& f) const;
+    double xHeight(const Font& f) const;
+    double height(const Font& f) const;
+    double ascent(const Font& f) const;
+    double descent(const Font& f) const;
+
+    bool inFont(const Font& f, Char ch) const;
+    bool inFontUcs4(const Font& f, char32_t ucs4) const;
+
+    double horizontalAdvance(const Font& f, const String& string) const;
+    double horizontalAdvance(const Font& f, const Char& ch) const;
+
+    RectF boundingRect(const Font& f, const String& string) const;
+    RectF boundingRect(const Font& f, const Char& ch) const;
+    RectF tightBoundingRect(const Font& f, const String& string) const;
+
+    //! NOTE Must be called when the set of available fonts or substitutions changes
+    void clear();
+
+    Stats stats() const;
+    void resetStats();
+
+private:
+    struct FontKey
+    {
+        String family;
+        double pointSize = -1.0;
+        int pixelSize = -1;
+        int weight = 0;
+        int style = 0;
+        bool noFontMerging = false;
+        int hinting = 0;
+
+        bool operator==(const FontKey& other) const;
+    };
+
+    struct FontKeyHash
+    {
+        size_t operator()(const FontKey& key) const;
+    };
+
+    struct FontData
+    {
+        FontData(const QFont& font, QPaintDevice* device);
+
+        QFontMetricsF metrics;
+
+        double lineSpacing = 0.0;
+        double xHeight = 0.0;
+        double height = 0.0;
+        double ascent = 0.0;
+        double descent = 0.0;
+
+        std::unordered_map<char32_t, bool> glyphsInFont;
+        std::unordered_map<char16_t, double> glyphAdvances;
+        std::unordered_map<char16_t, RectF> glyphBoundingRects;
+
+        std::unordered_map<String, double> stringAdvances;
+        std::unordered_map<String, RectF> stringBoundingRects;
+        std::unordered_map<String, RectF> stringTightBoundingRects;
+    };
+
+    static FontKey fontKey(const Font& f);
+
+    //! NOTE Must be called with the locked mutex
+    FontData& fontData(const Font& f) const;
+
+    template<typename Key, typename Value, typename Hash, typename Measure>
+    Value cached(std::unordered_map<Key, Value, Hash>& cache, const Key& key, Measure measure) const;
+
+    QPaintDevice* m_device = nullptr;
+
+    mutable std::mutex m_mutex;
+    mutable std::unordered_map<FontKey, std::unique_ptr<FontData>, FontKeyHash> m_fonts;
+
+    mutable std::atomic<uint64_t> m_hits = 0;
+    mutable std::atomic<uint64_t> m_misses = 0;
+};
+}
+
+#endif // MU_DRAW_FONTMETRICSCACHE_H
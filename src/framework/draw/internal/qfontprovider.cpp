@@ -28,6 +28,8 @@
 #include "engraving/libmscore/mscore.h"
 #include "fontengineft.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::draw;
 
@@ -53,55 +55,74 @@ protected:
 
 static FontPaintDevice device;
 
+QFontProvider::QFontProvider()
+    : m_metricsCache(&device)
+{
+}
+
+QFontProvider::~QFontProvider()
+{
+    FontMetricsCache::Stats stats = m_metricsCache.stats();
+    LOGI() << "font metrics cache: hits: " << stats.hits << ", misses: " << stats.misses
+           << ", hit rate: " << stats.hitRate();
+}
+
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
     m_symbolsFonts[family] = path;
-    return QFontDatabase::addApplicationFont(path.toQString());
+    int result = QFontDatabase::addApplicationFont(path.toQString());
+    m_metricsCache.clear();
+
+    return result;
 }
 
 int QFontProvider::addTextFont(const io::path_t& path)
 {
-    return QFontDatabase::addApplicationFont(path.toQString());
+    int result = QFontDatabase::addApplicationFont(path.toQString());
+    m_metricsCache.clear();
+
+    return result;
 }
 
 void QFontProvider::insertSubstitution(const String& familyName, const String& substituteName)
 {
     QFont::insertSubstitution(familyName, substituteName);
+    m_metricsCache.clear();
 }
 
 double QFontProvider::lineSpacing(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    return m_metricsCache.lineSpacing(f);
 }
 
 double QFontProvider::xHeight(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).xHeight();
+    return m_metricsCache.xHeight(f);
 }
 
 double QFontProvider::height(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).height();
+    return m_metricsCache.height(f);
 }
 
 double QFontProvider::ascent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).ascent();
+    return m_metricsCache.ascent(f);
 }
 
 double QFontProvider::descent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).descent();
+    return m_metricsCache.descent(f);
 }
 
 bool QFontProvider::inFont(const Font& f, Char ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    return m_metricsCache.inFont(f, ch);
 }
 
 bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 {
-    if (!QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4)) {
+    if (!m_metricsCache.inFontUcs4(f, ucs4)) {
         return false;
     }
 
@@ -113,22 +134,22 @@ bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    return m_metricsCache.horizontalAdvance(f, string);
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    return m_metricsCache.horizontalAdvance(f, ch);
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return m_metricsCache.boundingRect(f, string);
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    return m_metricsCache.boundingRect(f, ch);
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, const String& string) const
@@ -138,7 +159,7 @@ RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, cons
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    return m_metricsCache.tightBoundingRect(f, string);
 }
 
 // Score symbols
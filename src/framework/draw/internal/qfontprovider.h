@@ -25,12 +25,15 @@
 #include <QHash>
 #include "ifontprovider.h"
 
+#include "fontmetricscache.h"
+
 namespace mu::draw {
 class FontEngineFT;
 class QFontProvider : public IFontProvider
 {
 public:
-    QFontProvider() = default;
+    QFontProvider();
+    ~QFontProvider();
 
     int addSymbolFont(const String& family, const io::path_t& path) override;
     int addTextFont(const io::path_t& path) override;
@@ -64,6 +67,8 @@ private:
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+
+    FontMetricsCache m_metricsCache;
 };
 }
 
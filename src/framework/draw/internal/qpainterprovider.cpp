@@ -290,7 +290,7 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
+    static thread_local QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_DrawDataPaintTests : public ::testing::Test
+{
+public:
+};
+
+static void drawScene(Painter& painter)
+{
+    painter.setPen(Pen(Color::black, 2.0));
+    painter.drawLine(LineF(0.0, 0.0, 10.0, 0.0));
+
+    painter.save();
+    painter.translate(5.0, 5.0);
+    painter.scale(2.0, 2.0);
+    painter.setFont(Font(u"Bravura", Font::Type::MusicSymbol));
+    painter.drawText(PointF(1.0, 2.0), u"a");
+    painter.restore();
+
+    painter.setBrush(Brush(Color::redColor));
+    painter.drawRect(RectF(0.0, 0.0, 4.0, 3.0));
+}
+
+static DrawData record(const std::function<void(Painter&)>& draw)
+{
+    auto provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "test");
+        draw(painter);
+        painter.endDraw();
+    }
+
+    return provider->drawData();
+}
+
+//! NOTE The drawn primitives with the state they are drawn with, in drawing order,
+//! regardless of how they are grouped by states
+static std::vector<std::string> primitives(const DrawData& data)
+{
+    std::vector<std::string> result;
+
+    auto transformStr = [](const Transform& t) {
+        std::stringstream ss;
+        ss << t.m11() << " " << t.m22() << " " << t.dx() << " " << t.dy();
+        return ss.str();
+    };
+
+    for (const DrawData::Object& obj : data.objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            for (const DrawPath& path : d.paths) {
+                result.push_back("path " + std::to_string(path.path.elementCount()) + " " + transformStr(d.state.transform)
+                                 + " " + std::to_string(path.pen.widthF()) + " " + path.brush.color().toString());
+            }
+
+            for (const DrawPolygon& pl : d.polygons) {
+                result.push_back("polygon " + std::to_string(pl.polygon.size()) + " " + transformStr(d.state.transform)
+                                 + " " + std::to_string(d.state.pen.widthF()));
+            }
+
+            for (const DrawText& t : d.texts) {
+                result.push_back("text " + t.text.toStdString() + " " + transformStr(d.state.transform)
+                                 + " " + d.state.font.family().toStdString());
+            }
+        }
+    }
+
+    return result;
+}
+
+TEST_F(Draw_DrawDataPaintTests, SaveRestoreIsRecorded)
+{
+    //! DO Record a scene with save and restore
+    DrawData data = record(drawScene);
+
+    //! CHECK The drawing after restore has the state from before save
+    const DrawData::Object& obj = data.objects.back();
+    ASSERT_FALSE(obj.datas.empty());
+
+    const DrawData::Data& last = obj.datas.back();
+    ASSERT_EQ(last.paths.size(), 1);
+    EXPECT_EQ(last.state.transform, Transform());
+    EXPECT_EQ(last.state.brush.color(), Color::redColor);
+}
+
+TEST_F(Draw_DrawDataPaintTests, Replay)
+{
+    //! GIVEN Recorded scene
+    DrawData origin = record(drawScene);
+
+    //! DO Replay it on an untransformed painter
+    DrawData replayed = record([&origin](Painter& painter) {
+        DrawDataPaint::paint(&painter, origin);
+    });
+
+    //! CHECK The same is drawn
+    EXPECT_EQ(primitives(replayed), primitives(origin));
+    EXPECT_EQ(primitives(origin).size(), 3);
+}
+
+TEST_F(Draw_DrawDataPaintTests, ReplayWithTransform)
+{
+    //! GIVEN Recorded scene
+    DrawData origin = record(drawScene);
+
+    //! DO Replay it on a transformed painter, and draw after it
+    Transform view;
+    view.translate(100.0, 50.0);
+    view.scale(0.5, 0.5);
+
+    DrawData replayed = record([&origin, &view](Painter& painter) {
+        painter.setWorldTransform(view);
+        DrawDataPaint::paint(&painter, origin);
+        painter.drawLine(LineF(0.0, 0.0, 1.0, 1.0));
+    });
+
+    //! CHECK The recorded transforms are combined with the transform of the painter
+    std::vector<Transform> originTransforms;
+    for (const DrawData::Data& d : origin.objects.back().datas) {
+        originTransforms.push_back(d.state.transform * view);
+    }
+
+    std::vector<Transform> replayedTransforms;
+    for (const DrawData::Data& d : replayed.objects.back().datas) {
+        if (!d.empty()) {
+            replayedTransforms.push_back(d.state.transform);
+        }
+    }
+
+    ASSERT_EQ(replayedTransforms.size(), originTransforms.size() + 1);
+    for (size_t i = 0; i < originTransforms.size(); ++i) {
+        EXPECT_EQ(replayedTransforms.at(i), originTransforms.at(i));
+    }
+
+    //! CHECK The transform of the painter is not changed by the replay
+    EXPECT_EQ(replayedTransforms.back(), view);
+}
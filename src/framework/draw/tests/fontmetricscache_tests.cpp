@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <QFontMetricsF>
+#include <QImage>
+
+#include "draw/internal/fontmetricscache.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_FontMetricsCacheTests : public ::testing::Test
+{
+public:
+    Font testFont() const
+    {
+        Font font(u"Edwin", Font::Type::Text);
+        font.setPointSizeF(12.0);
+        return font;
+    }
+
+    QImage m_device = QImage(1, 1, QImage::Format_ARGB32_Premultiplied);
+};
+
+TEST_F(Draw_FontMetricsCacheTests, SameResultsAsFontMetrics)
+{
+    //! GIVEN Cache and Qt font metrics of the same font
+    FontMetricsCache cache(&m_device);
+    Font font = testFont();
+    QFontMetricsF metrics(font.toQFont(), &m_device);
+
+    //! CHECK The results are the same, also when taken from the cache
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_DOUBLE_EQ(cache.lineSpacing(font), metrics.lineSpacing());
+        EXPECT_DOUBLE_EQ(cache.ascent(font), metrics.ascent());
+        EXPECT_DOUBLE_EQ(cache.descent(font), metrics.descent());
+        EXPECT_DOUBLE_EQ(cache.horizontalAdvance(font, String(u"Allegro")), metrics.horizontalAdvance(QString("Allegro")));
+        EXPECT_DOUBLE_EQ(cache.horizontalAdvance(font, Char(u'W')), metrics.horizontalAdvance(QChar('W')));
+        EXPECT_EQ(cache.boundingRect(font, String(u"Allegro")), RectF::fromQRectF(metrics.boundingRect(QString("Allegro"))));
+        EXPECT_EQ(cache.tightBoundingRect(font, String(u"Allegro")),
+                  RectF::fromQRectF(metrics.tightBoundingRect(QString("Allegro"))));
+    }
+}
+
+TEST_F(Draw_FontMetricsCacheTests, Stats)
+{
+    //! GIVEN Empty cache
+    FontMetricsCache cache(&m_device);
+    Font font = testFont();
+
+    //! DO Measure the same string three times
+    for (int i = 0; i < 3; ++i) {
+        cache.horizontalAdvance(font, String(u"Andante"));
+    }
+
+    //! CHECK Only the first measure is a miss
+    FontMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 2.0 / 3.0);
+
+    //! DO Measure the same string with another font size
+    Font biggerFont = font;
+    biggerFont.setPointSizeF(24.0);
+    cache.horizontalAdvance(biggerFont, String(u"Andante"));
+
+    //! CHECK It is measured again
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+TEST_F(Draw_FontMetricsCacheTests, Clear)
+{
+    //! GIVEN Cache with a measured string
+    FontMetricsCache cache(&m_device);
+    Font font = testFont();
+    cache.horizontalAdvance(font, String(u"Adagio"));
+
+    //! DO Clear the cache, e.g. after the fonts are changed
+    cache.clear();
+    cache.resetStats();
+    cache.horizontalAdvance(font, String(u"Adagio"));
+
+    //! CHECK The string is measured again
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_EQ(cache.stats().hits, 0u);
+}
@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "drawdatapaint.h"
+
+#include "painter.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+static bool isTextWorkaroundNeeded(const Font& f, double scale)
+{
+    return scale < 1.0 && f.bold() && !(f.underline() || f.strike());
+}
+
+void DrawDataPaint::paint(Painter* painter, const DrawData& data, bool isTextWorkaroundAllowed)
+{
+    const Transform base = painter->worldTransform();
+
+    painter->save();
+
+    for (const DrawData::Object& obj : data.objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            const DrawData::State& st = d.state;
+
+            painter->setWorldTransform(st.transform * base);
+            painter->setAntialiasing(st.isAntialiasing);
+            painter->setCompositionMode(st.compositionMode);
+
+            for (const DrawPath& path : d.paths) {
+                painter->setPen(path.pen);
+                painter->setBrush(path.brush);
+                painter->drawPath(path.path);
+            }
+
+            painter->setPen(st.pen);
+            painter->setBrush(st.brush);
+
+            for (const DrawPolygon& pl : d.polygons) {
+                if (pl.polygon.empty()) {
+                    continue;
+                }
+
+                switch (pl.mode) {
+                case PolygonMode::OddEven:
+                    painter->drawPolygon(pl.polygon, FillRule::OddEvenFill);
+                    break;
+                case PolygonMode::Winding:
+                    painter->drawPolygon(pl.polygon, FillRule::WindingFill);
+                    break;
+                case PolygonMode::Convex:
+                    painter->drawConvexPolygon(pl.polygon);
+                    break;
+                case PolygonMode::Polyline:
+                    painter->drawPolyline(pl.polygon);
+                    break;
+                }
+            }
+
+            if (!d.texts.empty() || !d.rectTexts.empty()) {
+                Font font = st.font;
+                if (isTextWorkaroundAllowed && isTextWorkaroundNeeded(font, painter->worldTransform().m11())) {
+                    for (const DrawText& t : d.texts) {
+                        painter->drawTextWorkaround(font, t.pos, t.text);
+                    }
+                } else {
+                    painter->setFont(font);
+                    for (const DrawText& t : d.texts) {
+                        painter->drawText(t.pos, t.text);
+                    }
+                }
+
+                painter->setFont(font);
+                for (const DrawRectText& t : d.rectTexts) {
+                    painter->drawText(t.rect, t.flags, t.text);
+                }
+            }
+
+            for (const DrawPixmap& px : d.pixmaps) {
+                painter->drawPixmap(px.pos, px.pm);
+            }
+
+            for (const DrawTiledPixmap& px : d.tiledPixmap) {
+                painter->drawTiledPixmap(px.rect, px.pm, px.offset);
+            }
+        }
+    }
+
+    painter->restore();
+    painter->setWorldTransform(base);
+}
@@ -23,22 +23,39 @@
 #ifndef MU_GLOBAL_TASKCHEDULER_H
 #define MU_GLOBAL_TASKCHEDULER_H
 
+#include <algorithm>
 #include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <atomic>
-#include <queue>
+#include <set>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "log.h"
 
 namespace mu {
 typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
 
+//! NOTE Tasks of a higher priority are always taken before the queued tasks of a lower one.
+//! Background tasks never occupy all the threads, so that a RealTime or Normal task
+//! does not have to wait for a long background job to finish
+enum class TaskPriority {
+    RealTime = 0,
+    Normal,
+    Background
+};
+
+//! NOTE Work-stealing executor: every thread owns a deque per priority, takes its own tasks
+//! from the back and steals the tasks of other threads from the front.
+//! Tasks pushed from a scheduler thread go to the deque of that thread,
+//! tasks pushed from other threads are distributed between the deques in turn
 class TaskScheduler
 {
 public:
@@ -51,8 +68,7 @@ public:
     }
 
     explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
-        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
-        m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
+        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount))
     {
         setupThreads();
     }
@@ -70,21 +86,29 @@ public:
 
     template<typename FuncT, typename ... ArgsT>
     void push(FuncT&& task, ArgsT&&... args)
+    {
+        pushWithPriority(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT>
+    void pushWithPriority(TaskPriority priority, FuncT&& task, ArgsT&&... args)
     {
         std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        {
-            const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
-        }
-        m_newTaskAvailableCv.notify_one();
+        enqueue(priority, std::move(taskFunctor));
     }
 
     template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
     std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
+    {
+        return submitWithPriority(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submitWithPriority(TaskPriority priority, FuncT&& task, ArgsT&&... args)
     {
         std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
         std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
+        pushWithPriority(priority, [taskFunctor, promise] {
             try {
                 if constexpr (std::is_void_v<ReturnT>) {
                     std::invoke(taskFunctor);
@@ -104,107 +128,343 @@ public:
         return promise->get_future();
     }
 
-    void waitForAllTasksComplete()
+    //! NOTE Calls func(i) for every i in [begin, end) and returns when all calls are done.
+    //! The range is split into chunks of grainSize indices (chosen automatically when 0).
+    //! The calling thread processes chunks as well, so it is safe to call from a scheduler thread.
+    //! The first exception thrown by func is rethrown after all the chunks are done
+    template<typename IndexT, typename FuncT>
+    void parallel_for(IndexT begin, IndexT end, FuncT&& func, TaskPriority priority = TaskPriority::Normal, IndexT grainSize = 0)
     {
-        m_isWaitingForAllTasksDone = true;
-        std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
-        m_isWaitingForAllTasksDone = false;
+        if (end <= begin) {
+            return;
+        }
+
+        const size_t size = static_cast<size_t>(end - begin);
+        const size_t grain = grainSize > 0 ? static_cast<size_t>(grainSize) : autoGrainSize(size);
+
+        runChunks((size + grain - 1) / grain, priority, [&](size_t chunk) {
+            const size_t chunkBegin = chunk * grain;
+            const size_t chunkEnd = std::min(chunkBegin + grain, size);
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                func(static_cast<IndexT>(begin + static_cast<IndexT>(i)));
+            }
+        });
     }
 
-    const std::set<std::thread::id>& threadIdSet() const
+    //! NOTE Maps every index of [begin, end) with map(i) and combines the results with reduce(a, b).
+    //! The results are combined in the index order, so reduce has to be associative but not commutative
+    template<typename IndexT, typename ValueT, typename MapFuncT, typename ReduceFuncT>
+    ValueT parallel_reduce(IndexT begin, IndexT end, ValueT identity, MapFuncT&& map, ReduceFuncT&& reduce,
+                           TaskPriority priority = TaskPriority::Normal, IndexT grainSize = 0)
     {
-        static std::set<std::thread::id> result;
+        if (end <= begin) {
+            return identity;
+        }
+
+        const size_t size = static_cast<size_t>(end - begin);
+        const size_t grain = grainSize > 0 ? static_cast<size_t>(grainSize) : autoGrainSize(size);
+        const size_t chunkCount = (size + grain - 1) / grain;
 
-        if (result.empty()) {
-            for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-                result.insert(m_threadPool[i].get_id());
+        std::vector<ValueT> chunkResults(chunkCount, identity);
+
+        runChunks(chunkCount, priority, [&](size_t chunk) {
+            const size_t chunkBegin = chunk * grain;
+            const size_t chunkEnd = std::min(chunkBegin + grain, size);
+            ValueT result = identity;
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                result = reduce(std::move(result), map(static_cast<IndexT>(begin + static_cast<IndexT>(i))));
             }
+            chunkResults[chunk] = std::move(result);
+        });
+
+        ValueT result = std::move(identity);
+        for (ValueT& chunkResult : chunkResults) {
+            result = reduce(std::move(result), std::move(chunkResult));
         }
 
         return result;
     }
 
+    void waitForAllTasksComplete()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskFinishedCv.wait(lock, [this] { return m_unfinishedTaskCount == 0; });
+    }
+
+    const std::set<std::thread::id>& threadIdSet() const
+    {
+        return m_threadIdSet;
+    }
+
     bool containsThread(const std::thread::id& id) const
     {
-        const auto& idSet = threadIdSet();
-        return idSet.find(id) != idSet.cend();
+        return m_threadIdSet.find(id) != m_threadIdSet.cend();
     }
 
 private:
-    void setupThreads()
-    {
-        m_isActive = true;
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this);
+    static constexpr size_t PRIORITY_COUNT = 3;
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()> > tasks[PRIORITY_COUNT];
+    };
+
+    struct ChunksState {
+        std::function<void(size_t)> runChunk;
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk = 0;
+        std::atomic<size_t> doneChunkCount = 0;
+
+        std::mutex mutex;
+        std::condition_variable allDoneCv;
+        std::exception_ptr error;
+
+        //! NOTE Claims and runs chunks until none are left
+        void run()
+        {
+            for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                try {
+                    runChunk(chunk);
+                } catch (...) {
+                    std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+
+                if (++doneChunkCount == chunkCount) {
+                    std::lock_guard lock(mutex);
+                    allDoneCv.notify_all();
+                }
+            }
         }
+    };
+
+    size_t autoGrainSize(size_t size) const
+    {
+        //! NOTE A few chunks per thread, so that the threads that finish early can help the others
+        const size_t chunkCount = (m_threadPoolSize + 1) * 4;
+        return std::max<size_t>(1, size / chunkCount);
     }
 
-    void terminateThreads()
+    template<typename ChunkFuncT>
+    void runChunks(size_t chunkCount, TaskPriority priority, ChunkFuncT&& runChunk)
     {
-        m_isActive = false;
-        m_newTaskAvailableCv.notify_all();
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i].join();
+        std::shared_ptr<ChunksState> state = std::make_shared<ChunksState>();
+        state->runChunk = std::forward<ChunkFuncT>(runChunk);
+        state->chunkCount = chunkCount;
+
+        //! NOTE The helper tasks keep the state alive, but they only call runChunk
+        //! for the chunks claimed before all of them are done
+        const size_t helperCount = std::min<size_t>(m_threadPoolSize, chunkCount - 1);
+        for (size_t i = 0; i < helperCount; ++i) {
+            enqueue(priority, [state]() { state->run(); });
+        }
+
+        state->run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->allDoneCv.wait(lock, [&state] { return state->doneChunkCount == state->chunkCount; });
+
+        if (state->error) {
+            std::rethrow_exception(state->error);
         }
     }
 
-    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
+    void enqueue(TaskPriority priority, std::function<void()> task)
     {
-        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+        const size_t priorityIdx = static_cast<size_t>(priority);
 
-        if (maxCapacity <= 1) {
-            return 1;
+        size_t queueIdx = s_currentWorker.scheduler == this
+                          ? s_currentWorker.index
+                          : m_nextQueueIdx++ % m_threadPoolSize;
+
+        m_unfinishedTaskCount++;
+
+        //! NOTE The counter is changed before the task is queued, so it is never below the real number
+        //! of queued tasks, and before locking the mutex, so an idle worker either sees it or is already waiting
+        m_queuedTaskCount[priorityIdx]++;
+
+        {
+            WorkerQueue& queue = *m_queues[queueIdx];
+            std::lock_guard lock(queue.mutex);
+            queue.tasks[priorityIdx].push_back(std::move(task));
         }
 
-        thread_pool_size_t optimalCapacity = maxCapacity / 2;
+        {
+            std::lock_guard lock(m_mutex);
+        }
 
-        if (desiredThreadCount <= 0) {
-            return optimalCapacity;
+        m_newTaskAvailableCv.notify_one();
+    }
+
+    bool canTakeBackgroundTask() const
+    {
+        return m_threadPoolSize <= 1 || m_runningBackgroundTaskCount < m_threadPoolSize - 1;
+    }
+
+    bool hasTakeableTask() const
+    {
+        return m_queuedTaskCount[static_cast<size_t>(TaskPriority::RealTime)] > 0
+               || m_queuedTaskCount[static_cast<size_t>(TaskPriority::Normal)] > 0
+               || (m_queuedTaskCount[static_cast<size_t>(TaskPriority::Background)] > 0 && canTakeBackgroundTask());
+    }
+
+    bool takeTask(size_t workerIdx, size_t priorityIdx, std::function<void()>& task)
+    {
+        //! NOTE Own tasks are taken from the back, the most recent ones are likely still in cache
+        {
+            WorkerQueue& own = *m_queues[workerIdx];
+            std::lock_guard lock(own.mutex);
+            std::deque<std::function<void()> >& tasks = own.tasks[priorityIdx];
+            if (!tasks.empty()) {
+                task = std::move(tasks.back());
+                tasks.pop_back();
+                return true;
+            }
+        }
+
+        for (size_t i = 1; i < m_threadPoolSize; ++i) {
+            WorkerQueue& victim = *m_queues[(workerIdx + i) % m_threadPoolSize];
+            std::lock_guard lock(victim.mutex);
+            std::deque<std::function<void()> >& tasks = victim.tasks[priorityIdx];
+            if (!tasks.empty()) {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                return true;
+            }
         }
 
-        return desiredThreadCount;
+        return false;
     }
 
-    void th_workerLoop()
+    bool runNextTask(size_t workerIdx)
     {
-        while (m_isActive) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
+        for (size_t priorityIdx = 0; priorityIdx < PRIORITY_COUNT; ++priorityIdx) {
+            const bool isBackground = priorityIdx == static_cast<size_t>(TaskPriority::Background);
 
-            if (!m_isActive) {
-                return;
+            if (m_queuedTaskCount[priorityIdx] == 0) {
+                continue;
             }
 
-            std::function<void()> task = m_taskQueue.front();
-            m_taskQueue.pop();
+            if (isBackground) {
+                if (m_runningBackgroundTaskCount++ >= m_threadPoolSize - 1 && m_threadPoolSize > 1) {
+                    m_runningBackgroundTaskCount--;
+                    return false;
+                }
+            }
 
-            bool isQueueEmpty = m_taskQueue.empty();
+            std::function<void()> task;
+            if (!takeTask(workerIdx, priorityIdx, task)) {
+                if (isBackground) {
+                    m_runningBackgroundTaskCount--;
+                }
+                continue;
+            }
 
-            lock.unlock();
+            m_queuedTaskCount[priorityIdx]--;
 
             task();
 
-            if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
+            if (isBackground) {
+                m_runningBackgroundTaskCount--;
+
+                //! NOTE A background slot is free again
+                std::lock_guard lock(m_mutex);
+                m_newTaskAvailableCv.notify_one();
             }
 
-            if (isQueueEmpty) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (--m_unfinishedTaskCount == 0) {
+                std::lock_guard lock(m_mutex);
+                m_taskFinishedCv.notify_all();
             }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void setupThreads()
+    {
+        m_isActive = true;
+
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool.emplace_back(&TaskScheduler::th_workerLoop, this, i);
+            m_threadIdSet.insert(m_threadPool.back().get_id());
         }
     }
 
+    void terminateThreads()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_isActive = false;
+        }
+        m_newTaskAvailableCv.notify_all();
+
+        for (std::thread& thread : m_threadPool) {
+            thread.join();
+        }
+    }
+
+    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
+    {
+        if (desiredThreadCount > 0) {
+            return desiredThreadCount;
+        }
+
+        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+
+        if (maxCapacity <= 1) {
+            return 1;
+        }
+
+        return maxCapacity / 2;
+    }
+
+    void th_workerLoop(size_t workerIdx)
+    {
+        s_currentWorker.scheduler = this;
+        s_currentWorker.index = workerIdx;
+
+        while (m_isActive) {
+            if (runNextTask(workerIdx)) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_newTaskAvailableCv.wait(lock, [this] { return hasTakeableTask() || !m_isActive; });
+        }
+    }
+
+    //! NOTE Thread local, so zero initialized
+    struct CurrentWorker {
+        const TaskScheduler* scheduler;
+        size_t index;
+    };
+
+    static inline thread_local CurrentWorker s_currentWorker;
+
     std::atomic<bool> m_isActive = false;
-    std::atomic<bool> m_isWaitingForAllTasksDone = false;
 
     mutable std::mutex m_mutex;
     std::condition_variable m_newTaskAvailableCv;
     std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
+
+    std::vector<std::unique_ptr<WorkerQueue> > m_queues;
+    std::atomic<size_t> m_queuedTaskCount[PRIORITY_COUNT] = {};
+    std::atomic<size_t> m_unfinishedTaskCount = 0;
+    std::atomic<size_t> m_runningBackgroundTaskCount = 0;
+    std::atomic<size_t> m_nextQueueIdx = 0;
 
     thread_pool_size_t m_threadPoolSize = 0;
-    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
+    std::vector<std::thread> m_threadPool;
+    std::set<std::thread::id> m_threadIdSet;
 };
 }
 
@@ -384,13 +384,17 @@ struct ZipContainer::Impl {
         Directory, File, Symlink
     };
 
-    void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents, ZipContainer::CompressionPolicy policy);
+    void writeEntry(FileHeader& header, const std::string& fileName, const ByteArray& data);
 
     Impl(IODevice* d)
         : device(d) {}
 
     void scanFiles();
     ZipContainer::FileInfo fillFileInfo(int index) const;
+
+    const FileHeader* findFile(const std::string& fileName) const;
+    ByteArray readStoredData(const FileHeader& header) const;
 };
 
 void ZipContainer::Impl::scanFiles()
@@ -545,17 +549,17 @@ ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(int index) const
     return fileInfo;
 }
 
-void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents)
+void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents,
+                                  ZipContainer::CompressionPolicy policy)
 {
     if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
         status = ZipContainer::FileOpenError;
         return;
     }
-    device->seek(start_of_directory);
 
     // don't compress small files
-    ZipContainer::CompressionPolicy compression = compressionPolicy;
-    if (compressionPolicy == ZipContainer::AutoCompress) {
+    ZipContainer::CompressionPolicy compression = policy;
+    if (policy == ZipContainer::AutoCompress) {
         if (contents.size() < 64) {
             compression = ZipContainer::NeverCompress;
         } else {
@@ -598,30 +602,19 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
                 break;
             }
         } while (res == Z_BUF_ERROR);
+
+        // the data is incompressible (e.g. already compressed), so store the original
+        if (res == Z_OK && data.size() >= contents.size()) {
+            writeUShort(header.h.compression_method, CompressionMethodStored);
+            data = contents;
+        }
     }
-// TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
+
     writeUInt(header.h.compressed_size, (uint)data.size());
     uint crc_32 = ::crc32(0, 0, 0);
     crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
     writeUInt(header.h.crc_32, crc_32);
 
-    // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
-    ushort general_purpose_bits = Utf8Names; // always use utf-8
-    writeUShort(header.h.general_purpose_bits, general_purpose_bits);
-
-    //const bool inUtf8 = (general_purpose_bits & Utf8Names) != 0;
-    header.file_name = ByteArray(fileName.c_str(), fileName.size());
-    if (header.file_name.size() > 0xffff) {
-        LOGW("Zip: Filename is too long, chopping it to 65535 bytes");
-        header.file_name = header.file_name.left(0xffff); // ### don't break the utf-8 sequence, if any
-    }
-    if (header.file_comment.size() + header.file_name.size() > 0xffff) {
-        LOGW("Zip: File comment is too long, chopping it to 65535 bytes");
-        header.file_comment.truncate(0xffff - header.file_name.size()); // ### don't break the utf-8 sequence, if any
-    }
-    writeUShort(header.h.file_name_length, (ushort)header.file_name.size());
-    //h.extra_field_length[2];
-
     writeUShort(header.h.version_made, HostUnix << 8);
     //uint8_t internal_file_attributes[2];
     //uint8_t external_file_attributes[4];
@@ -641,6 +634,31 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         break;
     }
     writeUInt(header.h.external_file_attributes, mode << 16);
+
+    writeEntry(header, fileName, data);
+}
+
+void ZipContainer::Impl::writeEntry(FileHeader& header, const std::string& fileName, const ByteArray& data)
+{
+    device->seek(start_of_directory);
+
+    // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
+    ushort general_purpose_bits = Utf8Names; // always use utf-8
+    writeUShort(header.h.general_purpose_bits, general_purpose_bits);
+
+    //const bool inUtf8 = (general_purpose_bits & Utf8Names) != 0;
+    header.file_name = ByteArray(fileName.c_str(), fileName.size());
+    if (header.file_name.size() > 0xffff) {
+        LOGW("Zip: Filename is too long, chopping it to 65535 bytes");
+        header.file_name = header.file_name.left(0xffff); // ### don't break the utf-8 sequence, if any
+    }
+    if (header.file_comment.size() + header.file_name.size() > 0xffff) {
+        LOGW("Zip: File comment is too long, chopping it to 65535 bytes");
+        header.file_comment.truncate(0xffff - header.file_name.size()); // ### don't break the utf-8 sequence, if any
+    }
+    writeUShort(header.h.file_name_length, (ushort)header.file_name.size());
+    //h.extra_field_length[2];
+
     writeUInt(header.h.offset_local_header, start_of_directory);
 
     fileHeaders.push_back(header);
@@ -653,6 +671,33 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     dirtyFileTree = true;
 }
 
+const FileHeader* ZipContainer::Impl::findFile(const std::string& fileName) const
+{
+    for (const FileHeader& header : fileHeaders) {
+        if (header.file_name == ByteArray::fromRawData(fileName.c_str(), fileName.size())) {
+            return &header;
+        }
+    }
+
+    return nullptr;
+}
+
+ByteArray ZipContainer::Impl::readStoredData(const FileHeader& header) const
+{
+    int compressed_size = readUInt(header.h.compressed_size);
+    int start = readUInt(header.h.offset_local_header);
+
+    device->seek(start);
+    LocalFileHeader lh;
+    device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
+    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    device->seek(device->pos() + skip);
+
+    ByteArray data = device->read(compressed_size);
+    data.truncate(compressed_size);
+    return data;
+}
+
 ZipContainer::ZipContainer(IODevice* device)
     : p(new Impl(device))
 {
@@ -687,18 +732,12 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
     p->scanFiles();
 
-    size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == ByteArray::fromRawData(fileName.c_str(), fileName.size())) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    const FileHeader* found = p->findFile(fileName);
+    if (!found) {
         return ByteArray();
     }
 
-    FileHeader header = p->fileHeaders.at(i);
+    FileHeader header = *found;
 
     ushort version_needed = readUShort(header.h.version_needed);
     if (version_needed > ZIP_VERSION) {
@@ -709,22 +748,14 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
     ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
     int compressed_size = readUInt(header.h.compressed_size);
     int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
-
-    p->device->seek(start);
-    LocalFileHeader lh;
-    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
-    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    p->device->seek(p->device->pos() + skip);
-
-    int compression_method = readUShort(lh.compression_method);
+    int compression_method = readUShort(header.h.compression_method);
 
     if ((general_purpose_bits & Encrypted) != 0) {
         LOGW("Zip: Unsupported encryption method is needed to extract the data.");
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
+    ByteArray compressed = p->readStoredData(header);
     if (compression_method == CompressionMethodStored) {
         // no compression
         compressed.truncate(uncompressed_size);
@@ -732,7 +763,6 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
     } else if (compression_method == CompressionMethodDeflated) {
         // Deflate
         //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
         ByteArray baunzip;
         ulong len = std::max(uncompressed_size,  1);
         int res;
@@ -782,7 +812,12 @@ ZipContainer::CompressionPolicy ZipContainer::compressionPolicy() const
 
 void ZipContainer::addFile(const std::string& fileName, const ByteArray& data)
 {
-    p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data);
+    addFile(fileName, data, p->compressionPolicy);
+}
+
+void ZipContainer::addFile(const std::string& fileName, const ByteArray& data, CompressionPolicy policy)
+{
+    p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data, policy);
 }
 
 void ZipContainer::addDirectory(const std::string& dirName)
@@ -792,7 +827,86 @@ void ZipContainer::addDirectory(const std::string& dirName)
     if (name.back() != '/') {
         name.push_back('/');
     }
-    p->addEntry(Impl::Directory, name, ByteArray());
+    p->addEntry(Impl::Directory, name, ByteArray(), p->compressionPolicy);
+}
+
+bool ZipContainer::copyFile(const ZipContainer& source, const std::string& fileName, const ByteArray& data)
+{
+    std::string name = Dir::fromNativeSeparators(fileName).toStdString();
+
+    source.p->scanFiles();
+    const FileHeader* found = source.p->findFile(name);
+    if (!found) {
+        return false;
+    }
+
+    const FileHeader& sourceHeader = *found;
+
+    // compare the cheap fields first, the crc and the contents only if they match
+    if (readUInt(sourceHeader.h.uncompressed_size) != data.size()) {
+        return false;
+    }
+
+    ushort general_purpose_bits = readUShort(sourceHeader.h.general_purpose_bits);
+    if ((general_purpose_bits & Encrypted) != 0 || readUShort(sourceHeader.h.version_needed) > ZIP_VERSION) {
+        return false;
+    }
+
+    int compression_method = readUShort(sourceHeader.h.compression_method);
+    if (compression_method != CompressionMethodStored && compression_method != CompressionMethodDeflated) {
+        return false;
+    }
+
+    uint crc_32 = ::crc32(0, 0, 0);
+    crc_32 = ::crc32(crc_32, (const uint8_t*)data.constData(), (uint)data.size());
+    if (readUInt(sourceHeader.h.crc_32) != crc_32) {
+        return false;
+    }
+
+    ByteArray stored = source.p->readStoredData(sourceHeader);
+    if (stored.size() != readUInt(sourceHeader.h.compressed_size)) {
+        return false;
+    }
+
+    // equal size and crc don't mean equal contents, compare the bytes;
+    // inflating is still much cheaper than deflating the data again
+    if (!data.empty()) {
+        if (compression_method == CompressionMethodStored) {
+            if (std::memcmp(stored.constData(), data.constData(), data.size()) != 0) {
+                return false;
+            }
+        } else {
+            ByteArray inflated;
+            inflated.resize(data.size());
+            ulong len = static_cast<ulong>(inflated.size());
+            int res = inflate((uint8_t*)inflated.data(), &len, (const uint8_t*)stored.constData(), static_cast<ulong>(stored.size()));
+            if (res != Z_OK || len != data.size() || std::memcmp(inflated.constData(), data.constData(), data.size()) != 0) {
+                return false;
+            }
+        }
+    }
+
+    if (!(p->device->isOpen() || p->device->open(IODevice::WriteOnly))) {
+        p->status = ZipContainer::FileOpenError;
+        return false;
+    }
+
+    FileHeader header;
+    std::memset(&header.h, 0, sizeof(CentralFileHeader));
+    writeUInt(header.h.signature, 0x02014b50);
+
+    writeUShort(header.h.version_needed, ZIP_VERSION);
+    writeUShort(header.h.version_made, HostUnix << 8);
+    copyUShort(header.h.compression_method, sourceHeader.h.compression_method);
+    copyUInt(header.h.last_mod_file, sourceHeader.h.last_mod_file);
+    copyUInt(header.h.crc_32, sourceHeader.h.crc_32);
+    copyUInt(header.h.compressed_size, sourceHeader.h.compressed_size);
+    copyUInt(header.h.uncompressed_size, sourceHeader.h.uncompressed_size);
+    writeUInt(header.h.external_file_attributes, uint32_t(UnixFileAttributes::File) << 16);
+
+    p->writeEntry(header, name, stored);
+
+    return true;
 }
 
 void ZipContainer::close()
@@ -75,8 +75,13 @@ public:
     CompressionPolicy compressionPolicy() const;
 
     void addFile(const std::string& fileName, const ByteArray& data);
+    void addFile(const std::string& fileName, const ByteArray& data, CompressionPolicy policy);
     void addDirectory(const std::string& dirName);
 
+    //! NOTE Copies the file of the source as it is stored there, without inflating and deflating it,
+    //! if its contents are equal to the data. Returns false if it can't be copied.
+    bool copyFile(const ZipContainer& source, const std::string& fileName, const ByteArray& data);
+
 private:
 
     struct Impl;
@@ -21,23 +21,181 @@
  */
 #include "xmlstreamreader.h"
 
+#include <algorithm>
 #include <cstring>
 
-#include "thirdparty/tinyxml/tinyxml2.h"
-
 #include "log.h"
 
 using namespace mu;
 using namespace mu::io;
-using namespace tinyxml2;
+
+//! NOTE The reader tokenizes the document on demand, directly in its own copy of the data.
+//! Names, attribute values and texts are decoded and null-terminated in place,
+//! so AsciiStringView results point into that buffer and stay valid until the next setData.
 
 struct XmlStreamReader::Xml {
-    XMLDocument doc;
-    XMLNode* node = nullptr;
-    XMLError err;
+    struct Attr {
+        AsciiStringView name;
+        AsciiStringView value;
+    };
+
+    ByteArray data;
+    char* pos = nullptr;
+    char* end = nullptr;
+    bool tagAtPos = false;      // `pos` points to a '<' (possibly already overwritten by a terminator)
+    bool rootFound = false;
+    bool selfClosing = false;   // the current start element is empty, the next token is its end
+    int64_t line = 1;
+
+    std::vector<AsciiStringView> elements;
+    AsciiStringView name;
+    AsciiStringView value;
+    std::vector<Attr> attrs;
+
+    Error err = NoError;
+    String errStr;
     String customErr;
 };
 
+static inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+static inline bool isNameEnd(char c)
+{
+    return isSpace(c) || c == '>' || c == '/' || c == '=' || c == '\0';
+}
+
+static size_t writeUtf8(char* out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out[0] = static_cast<char>(cp);
+        return 1;
+    } else if (cp < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (cp >> 6));
+        out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (cp >> 12));
+        out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 3;
+    } else if (cp < 0x110000) {
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+    return 0;
+}
+
+//! NOTE Reads the entity at `p` (pointing to '&'), writes the decoded bytes to `out`.
+//! Returns the number of consumed source bytes, or 0 if the entity is unknown.
+//! The decoded form is never longer than the entity itself.
+static size_t decodeEntity(const char* p, const char* end, char* out, size_t& written)
+{
+    struct Entity {
+        const char* name;
+        size_t size;
+        char value;
+    };
+
+    static const Entity ENTITIES[] = {
+        { "quot", 4, '"' },
+        { "amp", 3, '&' },
+        { "apos", 4, '\'' },
+        { "lt", 2, '<' },
+        { "gt", 2, '>' }
+    };
+
+    const char* semicolon = static_cast<const char*>(std::memchr(p, ';', std::min<size_t>(end - p, 12)));
+    if (!semicolon) {
+        return 0;
+    }
+
+    const char* ref = p + 1;
+    size_t refSize = semicolon - ref;
+
+    if (refSize > 1 && ref[0] == '#') {
+        bool hex = ref[1] == 'x' || ref[1] == 'X';
+        const char* digit = ref + (hex ? 2 : 1);
+        if (digit == semicolon) {
+            return 0;
+        }
+
+        uint32_t cp = 0;
+        for (; digit < semicolon; ++digit) {
+            char c = *digit;
+            uint32_t d = 0;
+            if (c >= '0' && c <= '9') {
+                d = c - '0';
+            } else if (hex && c >= 'a' && c <= 'f') {
+                d = c - 'a' + 10;
+            } else if (hex && c >= 'A' && c <= 'F') {
+                d = c - 'A' + 10;
+            } else {
+                return 0;
+            }
+            cp = cp * (hex ? 16 : 10) + d;
+            if (cp >= 0x110000) {
+                return 0;
+            }
+        }
+
+        written = writeUtf8(out, cp);
+        return written ? refSize + 2 : 0;
+    }
+
+    for (const Entity& e : ENTITIES) {
+        if (e.size == refSize && std::strncmp(ref, e.name, refSize) == 0) {
+            out[0] = e.value;
+            written = 1;
+            return refSize + 2;
+        }
+    }
+
+    return 0;
+}
+
+//! NOTE Normalizes newlines and (optionally) resolves entities in place,
+//! returns the new end of the data
+static char* decodeInPlace(char* begin, char* end, bool processEntities)
+{
+    char* w = begin;
+    char* r = begin;
+    while (r < end) {
+        char c = *r;
+        if (c == '\r') {
+            *w++ = '\n';
+            ++r;
+            if (r < end && *r == '\n') {
+                ++r;
+            }
+        } else if (c == '&' && processEntities) {
+            char buf[4];
+            size_t written = 0;
+            size_t consumed = decodeEntity(r, end, buf, written);
+            if (consumed) {
+                std::memcpy(w, buf, written);
+                w += written;
+                r += consumed;
+            } else {
+                *w++ = *r++;
+            }
+        } else {
+            *w++ = *r++;
+        }
+    }
+    return w;
+}
+
+static inline void terminate(const AsciiStringView& v)
+{
+    const_cast<char*>(v.ascii())[v.size()] = '\0';
+}
+
 XmlStreamReader::XmlStreamReader()
 {
     m_xml = new Xml();
@@ -73,16 +231,52 @@ XmlStreamReader::~XmlStreamReader()
 
 void XmlStreamReader::setData(const ByteArray& data)
 {
-    m_xml->doc.Clear();
-    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
-    m_token = m_xml->err == XML_SUCCESS ? TokenType::NoToken : TokenType::Invalid;
+    //! NOTE The data is tokenized in place, so we need our own (null-terminated) copy of it
+    m_xml->data = ByteArray(data.constData(), data.size());
+    m_xml->pos = reinterpret_cast<char*>(m_xml->data.data());
+    m_xml->end = m_xml->pos + data.size();
+    m_xml->tagAtPos = false;
+    m_xml->rootFound = false;
+    m_xml->selfClosing = false;
+    m_xml->line = 1;
+    m_xml->elements.clear();
+    m_xml->name = AsciiStringView();
+    m_xml->value = AsciiStringView();
+    m_xml->attrs.clear();
+    m_xml->err = NoError;
+    m_xml->errStr.clear();
     m_xml->customErr.clear();
+    m_entities.clear();
+
+    // skip UTF-8 BOM
+    if (m_xml->end - m_xml->pos >= 3 && std::memcmp(m_xml->pos, "\xEF\xBB\xBF", 3) == 0) {
+        m_xml->pos += 3;
+    }
+
+    m_token = TokenType::NoToken;
 
-    if (m_xml->err != XML_SUCCESS) {
-        LOGE() << errorString();
+    const char* p = m_xml->pos;
+    while (p < m_xml->end && isSpace(*p)) {
+        ++p;
+    }
+
+    if (p == m_xml->end) {
+        setParseError(u"Document is empty");
+        m_token = TokenType::Invalid;
     }
 }
 
+void XmlStreamReader::setParseError(const String& message, Error err)
+{
+    if (m_xml->err != NoError) {
+        return;
+    }
+
+    m_xml->err = err;
+    m_xml->errStr = message + u" (line " + String::number(m_xml->line) + u")";
+    LOGE() << errorString();
+}
+
 bool XmlStreamReader::readNextStartElement()
 {
     while (readNext() != Invalid) {
@@ -100,87 +294,269 @@ bool XmlStreamReader::atEnd() const
     return m_token == TokenType::EndDocument || m_token == TokenType::Invalid;
 }
 
-static XmlStreamReader::TokenType resolveToken(XMLNode* n, bool isStartElement)
+XmlStreamReader::TokenType XmlStreamReader::readNext()
 {
-    if (n->ToElement()) {
-        return isStartElement ? XmlStreamReader::TokenType::StartElement : XmlStreamReader::TokenType::EndElement;
-    } else if (n->ToText()) {
-        return XmlStreamReader::TokenType::Characters;
-    } else if (n->ToComment()) {
-        return XmlStreamReader::TokenType::Comment;
-    } else if (n->ToDeclaration()) {
-        return XmlStreamReader::TokenType::StartDocument;
-    } else if (n->ToDocument()) {
-        return XmlStreamReader::TokenType::EndDocument;
-    } else if (n->ToUnknown()) {
-        return XmlStreamReader::TokenType::DTD;
+    if (m_token == TokenType::Invalid) {
+        return m_token;
+    }
+
+    if (m_xml->err != NoError || m_token == EndDocument) {
+        m_token = TokenType::Invalid;
+        return m_token;
+    }
+
+    m_xml->attrs.clear();
+    m_xml->value = AsciiStringView();
+
+    if (m_xml->selfClosing) {
+        m_xml->selfClosing = false;
+        m_xml->name = m_xml->elements.back();
+        m_xml->elements.pop_back();
+        m_token = TokenType::EndElement;
+        return m_token;
     }
-    return XmlStreamReader::TokenType::Unknown;
+
+    m_token = parseNext();
+    if (m_xml->err != NoError) {
+        m_token = TokenType::Invalid;
+    }
+
+    if (m_token == TokenType::DTD) {
+        tryParseEntity(m_xml);
+    }
+
+    return m_token;
 }
 
-static std::pair<XMLNode*, XmlStreamReader::TokenType> resolveNode(XMLNode* currentNode, XmlStreamReader::TokenType currentToken)
+XmlStreamReader::TokenType XmlStreamReader::parseNext()
 {
-    if (currentToken == XmlStreamReader::TokenType::StartElement) {
-        XMLNode* child = currentNode->FirstChild();
-        if (child) {
-            return { child, resolveToken(child, true) };
+    Xml* xml = m_xml;
+    char* end = xml->end;
+
+    if (!xml->tagAtPos) {
+        char* start = xml->pos;
+        char* p = start;
+        while (p < end && isSpace(*p)) {
+            ++p;
+        }
+
+        if (p < end && *p != '<') {
+            // text, ends at the next tag (leading and trailing spaces belong to it)
+            char* textEnd = static_cast<char*>(std::memchr(p, '<', end - p));
+            if (!textEnd) {
+                textEnd = end;
+            }
+
+            xml->line += std::count(start, textEnd, '\n');
+            char* decodedEnd = decodeInPlace(start, textEnd, true);
+            *decodedEnd = '\0';
+
+            xml->value = AsciiStringView(start, decodedEnd - start);
+            xml->name = AsciiStringView();
+            xml->pos = textEnd;
+            xml->tagAtPos = textEnd < end;
+            return TokenType::Characters;
         }
 
-        XMLNode* sibling = currentNode->NextSibling();
-        if (!sibling || sibling->ToElement() || sibling->ToText()) {
-            return { currentNode, XmlStreamReader::TokenType::EndElement };
+        xml->line += std::count(start, p, '\n');
+        xml->pos = p;
+
+        if (p == end) {
+            if (!xml->elements.empty()) {
+                setParseError(u"Premature end of document", PrematureEndOfDocumentError);
+                return TokenType::Invalid;
+            }
+            return TokenType::EndDocument;
         }
     }
 
-    XMLNode* sibling = currentNode->NextSibling();
-    if (sibling) {
-        return { sibling, resolveToken(sibling, true) };
+    xml->tagAtPos = false;
+
+    char* tag = xml->pos;
+    char* p = tag + 1;
+
+    auto findSeq = [end](char* from, const char* seq, size_t seqSize) -> char* {
+        for (char* s = from; s + seqSize <= end; ++s) {
+            s = static_cast<char*>(std::memchr(s, seq[0], end - s));
+            if (!s || s + seqSize > end) {
+                return nullptr;
+            }
+            if (std::memcmp(s, seq, seqSize) == 0) {
+                return s;
+            }
+        }
+        return nullptr;
+    };
+
+    // the content of a special tag, between the given prefix and suffix
+    auto readSpecial = [this, xml, tag, &findSeq](size_t prefixSize, const char* suffix, bool normalize) -> bool {
+        char* begin = tag + prefixSize;
+        size_t suffixSize = std::strlen(suffix);
+        char* contentEnd = findSeq(begin, suffix, suffixSize);
+        if (!contentEnd) {
+            setParseError(u"Unterminated markup", PrematureEndOfDocumentError);
+            return false;
+        }
+
+        xml->line += std::count(tag, contentEnd + suffixSize, '\n');
+        char* decodedEnd = normalize ? decodeInPlace(begin, contentEnd, false) : contentEnd;
+        *decodedEnd = '\0';
+
+        xml->value = AsciiStringView(begin, decodedEnd - begin);
+        xml->name = AsciiStringView();
+        xml->pos = contentEnd + suffixSize;
+        return true;
+    };
+
+    if (p < end && *p == '/') {
+        // end element
+        char* nameBegin = p + 1;
+        char* nameEnd = nameBegin;
+        while (nameEnd < end && !isNameEnd(*nameEnd)) {
+            ++nameEnd;
+        }
+
+        char* close = nameEnd;
+        while (close < end && isSpace(*close)) {
+            ++close;
+        }
+
+        if (close == end) {
+            setParseError(u"Premature end of document", PrematureEndOfDocumentError);
+            return TokenType::Invalid;
+        }
+
+        AsciiStringView closeName(nameBegin, nameEnd - nameBegin);
+        if (*close != '>' || xml->elements.empty() || xml->elements.back() != closeName) {
+            setParseError(u"Mismatched end element");
+            return TokenType::Invalid;
+        }
+
+        xml->line += std::count(tag, close, '\n');
+        xml->name = xml->elements.back();
+        xml->elements.pop_back();
+        xml->pos = close + 1;
+        return TokenType::EndElement;
     }
 
-    XMLNode* parent = currentNode->Parent();
-    if (parent) {
-        return { parent, resolveToken(parent, false) };
+    if (end - p >= 3 && std::memcmp(p, "!--", 3) == 0) {
+        return readSpecial(4, "-->", true) ? TokenType::Comment : TokenType::Invalid;
     }
 
-    return { nullptr, XmlStreamReader::TokenType::EndDocument };
-}
+    if (end - p >= 8 && std::memcmp(p, "![CDATA[", 8) == 0) {
+        return readSpecial(9, "]]>", true) ? TokenType::Characters : TokenType::Invalid;
+    }
 
-XmlStreamReader::TokenType XmlStreamReader::readNext()
-{
-    if (m_token == TokenType::Invalid) {
-        return m_token;
+    if (p < end && *p == '?') {
+        return readSpecial(2, "?>", false) ? TokenType::StartDocument : TokenType::Invalid;
     }
 
-    if (m_xml->err != XML_SUCCESS || m_token == EndDocument) {
-        m_xml->node = nullptr;
-        m_token = TokenType::Invalid;
-        return m_token;
+    if (p < end && *p == '!') {
+        return readSpecial(2, ">", false) ? TokenType::DTD : TokenType::Invalid;
     }
 
-    if (!m_xml->node) {
-        m_xml->node = m_xml->doc.FirstChild();
-        m_token = m_xml->node->ToDeclaration() ? TokenType::StartDocument : resolveToken(m_xml->node, true);
-        return m_token;
+    // start element
+    char* nameEnd = p;
+    while (nameEnd < end && !isNameEnd(*nameEnd)) {
+        ++nameEnd;
     }
 
-    std::pair<XMLNode*, XmlStreamReader::TokenType> p = resolveNode(m_xml->node, m_token);
+    if (nameEnd == p) {
+        setParseError(u"Invalid element name");
+        return TokenType::Invalid;
+    }
 
-    m_xml->node = p.first;
-    m_token = p.second;
+    if (xml->elements.empty() && xml->rootFound) {
+        setParseError(u"Extra content at the end of the document");
+        return TokenType::Invalid;
+    }
 
-    if (m_token == XmlStreamReader::TokenType::DTD) {
-        tryParseEntity(m_xml);
+    AsciiStringView name(p, nameEnd - p);
+
+    // attributes
+    p = nameEnd;
+    for (;;) {
+        while (p < end && isSpace(*p)) {
+            ++p;
+        }
+
+        if (p == end) {
+            setParseError(u"Premature end of document", PrematureEndOfDocumentError);
+            return TokenType::Invalid;
+        }
+
+        if (*p == '>') {
+            xml->selfClosing = false;
+            break;
+        }
+
+        if (*p == '/') {
+            if (p + 1 == end || p[1] != '>') {
+                setParseError(u"Expected '>' after '/'");
+                return TokenType::Invalid;
+            }
+            xml->selfClosing = true;
+            ++p;
+            break;
+        }
+
+        char* attrNameEnd = p;
+        while (attrNameEnd < end && !isNameEnd(*attrNameEnd)) {
+            ++attrNameEnd;
+        }
+
+        char* eq = attrNameEnd;
+        while (eq < end && isSpace(*eq)) {
+            ++eq;
+        }
+
+        char* quote = eq + 1;
+        while (quote < end && isSpace(*quote)) {
+            ++quote;
+        }
+
+        if (attrNameEnd == p || eq == end || *eq != '=' || quote >= end || (*quote != '"' && *quote != '\'')) {
+            setParseError(u"Invalid attribute");
+            return TokenType::Invalid;
+        }
+
+        char* valueEnd = static_cast<char*>(std::memchr(quote + 1, *quote, end - quote - 1));
+        if (!valueEnd) {
+            setParseError(u"Premature end of document", PrematureEndOfDocumentError);
+            return TokenType::Invalid;
+        }
+
+        xml->attrs.push_back({ AsciiStringView(p, attrNameEnd - p), AsciiStringView(quote + 1, valueEnd - quote - 1) });
+        p = valueEnd + 1;
     }
 
-    return m_token;
+    xml->line += std::count(tag, p, '\n');
+    xml->pos = p + 1;
+
+    // now the tag is parsed, so the separators can be overwritten by terminators
+    terminate(name);
+    for (Xml::Attr& a : xml->attrs) {
+        terminate(a.name);
+
+        char* valueBegin = const_cast<char*>(a.value.ascii());
+        char* decodedEnd = decodeInPlace(valueBegin, valueBegin + a.value.size(), true);
+        *decodedEnd = '\0';
+        a.value = AsciiStringView(valueBegin, decodedEnd - valueBegin);
+    }
+
+    xml->rootFound = true;
+    xml->elements.push_back(name);
+    xml->name = name;
+
+    return TokenType::StartElement;
 }
 
 void XmlStreamReader::tryParseEntity(Xml* xml)
 {
     static const char* ENTITY = { "ENTITY" };
 
-    const char* str = xml->node->Value();
-    if (std::strncmp(str, ENTITY, 6) == 0) {
+    const char* str = xml->value.ascii();
+    if (str && std::strncmp(str, ENTITY, 6) == 0) {
         String val = String::fromUtf8(str);
         StringList list = val.split(' ');
         if (list.size() == 3) {
@@ -195,7 +571,7 @@ void XmlStreamReader::tryParseEntity(Xml* xml)
 
 String XmlStreamReader::nodeValue(Xml* xml) const
 {
-    String str = String::fromUtf8(xml->node->Value());
+    String str = String::fromUtf8(xml->value.ascii());
     if (!m_entities.empty()) {
         for (const auto& p : m_entities) {
             str.replace(p.first, p.second);
@@ -245,33 +621,35 @@ void XmlStreamReader::skipCurrentElement()
 
 AsciiStringView XmlStreamReader::name() const
 {
-    return (m_xml->node && m_xml->node->ToElement()) ? m_xml->node->Value() : AsciiStringView();
+    return (m_token == TokenType::StartElement || m_token == TokenType::EndElement) ? m_xml->name : AsciiStringView();
 }
 
-bool XmlStreamReader::hasAttribute(const char* name) const
+const AsciiStringView* XmlStreamReader::findAttribute(const char* name) const
 {
     if (m_token != TokenType::StartElement) {
-        return false;
+        return nullptr;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return false;
+    for (const Xml::Attr& a : m_xml->attrs) {
+        if (a.name == name) {
+            return &a.value;
+        }
     }
-    return e->FindAttribute(name) != nullptr;
+    return nullptr;
 }
 
-String XmlStreamReader::attribute(const char* name) const
+bool XmlStreamReader::hasAttribute(const char* name) const
 {
-    if (m_token != TokenType::StartElement) {
-        return String();
-    }
+    return findAttribute(name) != nullptr;
+}
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
+String XmlStreamReader::attribute(const char* name) const
+{
+    const AsciiStringView* value = findAttribute(name);
+    if (!value) {
         return String();
     }
-    return String::fromUtf8(e->Attribute(name));
+    return String::fromUtf8(value->ascii());
 }
 
 String XmlStreamReader::attribute(const char* name, const String& def) const
@@ -281,15 +659,11 @@ String XmlStreamReader::attribute(const char* name, const String& def) const
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
 {
-    if (m_token != TokenType::StartElement) {
+    const AsciiStringView* value = findAttribute(name);
+    if (!value) {
         return AsciiStringView();
     }
-
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return AsciiStringView();
-    }
-    return e->Attribute(name);
+    return *value;
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name, const AsciiStringView& def) const
@@ -324,15 +698,11 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
         return attrs;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return attrs;
-    }
-
-    for (const XMLAttribute* xa = e->FirstAttribute(); xa; xa = xa->Next()) {
+    attrs.reserve(m_xml->attrs.size());
+    for (const Xml::Attr& xa : m_xml->attrs) {
         Attribute a;
-        a.name = xa->Name();
-        a.value = String::fromUtf8(xa->Value());
+        a.name = xa.name;
+        a.value = String::fromUtf8(xa.value.ascii());
         attrs.push_back(std::move(a));
     }
     return attrs;
@@ -340,7 +710,7 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
 
 String XmlStreamReader::text() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
+    if (m_token == TokenType::Characters || m_token == TokenType::Comment) {
         return nodeValue(m_xml);
     }
     return String();
@@ -348,8 +718,8 @@ String XmlStreamReader::text() const
 
 AsciiStringView XmlStreamReader::asciiText() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
-        return m_xml->node->Value();
+    if (m_token == TokenType::Characters || m_token == TokenType::Comment) {
+        return m_xml->value;
     }
     return AsciiStringView();
 }
@@ -365,6 +735,8 @@ String XmlStreamReader::readText()
                 break;
             case EndElement:
                 return result;
+            case Invalid:
+                return result;
             case Comment:
                 break;
             case StartElement:
@@ -384,10 +756,12 @@ AsciiStringView XmlStreamReader::readAsciiText()
         while (1) {
             switch (readNext()) {
             case Characters:
-                result = AsciiStringView(m_xml->node->Value());
+                result = m_xml->value;
                 break;
             case EndElement:
                 return result;
+            case Invalid:
+                return result;
             case Comment:
                 break;
             case StartElement:
@@ -414,7 +788,7 @@ double XmlStreamReader::readDouble(bool* ok)
 
 int64_t XmlStreamReader::lineNumber() const
 {
-    return m_xml->doc.ErrorLineNum();
+    return m_xml->line;
 }
 
 int64_t XmlStreamReader::columnNumber() const
@@ -428,12 +802,7 @@ XmlStreamReader::Error XmlStreamReader::error() const
         return CustomError;
     }
 
-    XMLError err = m_xml->doc.ErrorID();
-    if (err == XML_SUCCESS) {
-        return NoError;
-    }
-
-    return NotWellFormedError;
+    return m_xml->err;
 }
 
 bool XmlStreamReader::isError() const
@@ -446,7 +815,7 @@ String XmlStreamReader::errorString() const
     if (!m_xml->customErr.empty()) {
         return m_xml->customErr;
     }
-    return String::fromUtf8(m_xml->doc.ErrorStr());
+    return m_xml->errStr;
 }
 
 void XmlStreamReader::raiseError(const String& message)
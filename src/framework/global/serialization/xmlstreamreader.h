@@ -123,6 +123,10 @@ public:
 private:
     struct Xml;
 
+    TokenType parseNext();
+    void setParseError(const String& message, Error err = NotWellFormedError);
+    const AsciiStringView* findAttribute(const char* name) const;
+
     void tryParseEntity(Xml* xml);
     String nodeValue(Xml* xml) const;
 
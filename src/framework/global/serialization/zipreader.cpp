@@ -100,3 +100,8 @@ ByteArray ZipReader::fileData(const std::string& fileName) const
 {
     return m_impl->zip->fileData(fileName);
 }
+
+ZipContainer* ZipReader::container() const
+{
+    return m_impl->zip;
+}
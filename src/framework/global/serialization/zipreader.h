@@ -28,6 +28,7 @@
 #include "io/iodevice.h"
 
 namespace mu {
+class ZipContainer;
 class ZipReader
 {
 public:
@@ -55,6 +56,10 @@ public:
     ByteArray fileData(const std::string& fileName) const;
 
 private:
+    friend class ZipWriter;
+
+    ZipContainer* container() const;
+
     struct Impl;
     Impl* m_impl = nullptr;
     io::path_t m_filePath;
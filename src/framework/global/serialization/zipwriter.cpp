@@ -22,6 +22,7 @@
 #include "zipwriter.h"
 
 #include "internal/zipcontainer.h"
+#include "zipreader.h"
 #include "io/file.h"
 
 #include "log.h"
@@ -89,8 +90,18 @@ bool ZipWriter::hasError() const
     return m_impl->zip->status() != ZipContainer::NoError;
 }
 
-void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
+void ZipWriter::addFile(const std::string& fileName, const ByteArray& data, bool compress)
 {
-    m_impl->zip->addFile(fileName, data);
+    m_impl->zip->addFile(fileName, data, compress ? ZipContainer::AlwaysCompress : ZipContainer::NeverCompress);
     flush();
 }
+
+bool ZipWriter::copyFile(const ZipReader& source, const std::string& fileName, const ByteArray& data)
+{
+    if (!m_impl->zip->copyFile(*source.container(), fileName, data)) {
+        return false;
+    }
+
+    flush();
+    return true;
+}
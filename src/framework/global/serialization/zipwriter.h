@@ -26,6 +26,7 @@
 #include "io/iodevice.h"
 
 namespace mu {
+class ZipReader;
 class ZipWriter
 {
 public:
@@ -37,7 +38,11 @@ public:
     void close();
     bool hasError() const;
 
-    void addFile(const std::string& fileName, const ByteArray& data);
+    void addFile(const std::string& fileName, const ByteArray& data, bool compress = true);
+
+    //! NOTE Copies the file from the source zip without inflating and deflating it,
+    //! if its contents there are equal to the data. Returns false if it isn't copied.
+    bool copyFile(const ZipReader& source, const std::string& fileName, const ByteArray& data);
 
 private:
 
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "concurrency/taskscheduler.h"
+
+using namespace mu;
+
+class Global_Concurrency_TaskSchedulerTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, Submit)
+{
+    //! GIVEN Scheduler with several threads
+    TaskScheduler scheduler(3);
+
+    //! DO Submit tasks
+    std::vector<std::future<int> > futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(scheduler.submit([i]() { return i * 2; }));
+    }
+
+    //! CHECK Every task returned its result
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(futures[i].get(), i * 2);
+    }
+
+    //! CHECK Exceptions are passed to the future
+    std::future<void> failed = scheduler.submit([]() { throw std::runtime_error("error"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor)
+{
+    //! GIVEN Scheduler with several threads
+    TaskScheduler scheduler(3);
+
+    //! DO Run parallel_for over ranges of different sizes
+    for (int size : { 0, 1, 5, 100, 10000 }) {
+        std::vector<std::atomic<int> > calls(size);
+        scheduler.parallel_for(0, size, [&calls](int i) { calls[i]++; });
+
+        //! CHECK Every index was processed exactly once
+        for (int i = 0; i < size; ++i) {
+            ASSERT_EQ(calls[i], 1) << "size: " << size << ", index: " << i;
+        }
+    }
+
+    //! CHECK The range does not have to start at zero
+    std::atomic<int> sum = 0;
+    scheduler.parallel_for(10, 20, [&sum](int i) { sum += i; }, TaskPriority::Background, 3);
+    EXPECT_EQ(sum, 145);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelForNested)
+{
+    //! GIVEN Scheduler with two threads
+    TaskScheduler scheduler(2);
+
+    //! DO Run parallel_for from the tasks of another parallel_for
+    std::atomic<int> count = 0;
+    scheduler.parallel_for(0, 8, [&](int) {
+        scheduler.parallel_for(0, 100, [&count](int) { count++; });
+    }, TaskPriority::Normal, 1);
+
+    //! CHECK Nothing is lost and nothing deadlocks
+    EXPECT_EQ(count, 800);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelForException)
+{
+    TaskScheduler scheduler(2);
+
+    //! DO Throw from one index
+    std::atomic<int> count = 0;
+    auto func = [&count](int i) {
+        count++;
+        if (i == 50) {
+            throw std::runtime_error("error");
+        }
+    };
+
+    //! CHECK The exception is rethrown after all the other chunks are processed
+    EXPECT_THROW(scheduler.parallel_for(0, 100, func, TaskPriority::Normal, 1), std::runtime_error);
+    EXPECT_EQ(count, 100);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelReduce)
+{
+    TaskScheduler scheduler(3);
+
+    //! CHECK Sum
+    long long sum = scheduler.parallel_reduce(0, 100000, 0LL,
+                                              [](int i) { return static_cast<long long>(i); },
+                                              [](long long a, long long b) { return a + b; });
+    EXPECT_EQ(sum, 4999950000LL);
+
+    //! CHECK Results are combined in the index order
+    std::string str = scheduler.parallel_reduce(0, 26, std::string(),
+                                                [](int i) { return std::string(1, char('a' + i)); },
+                                                [](std::string a, const std::string& b) { return a + b; },
+                                                TaskPriority::Normal, 2);
+    EXPECT_EQ(str, "abcdefghijklmnopqrstuvwxyz");
+
+    //! CHECK Empty range
+    EXPECT_EQ(scheduler.parallel_reduce(5, 5, 42, [](int i) { return i; }, [](int a, int b) { return a + b; }), 42);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, Priorities)
+{
+    //! GIVEN Scheduler with one thread, which is busy
+    TaskScheduler scheduler(1);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    scheduler.push([released]() { released.wait(); });
+
+    //! DO Queue tasks of different priorities
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto record = [&mutex, &order](const std::string& name) {
+        std::lock_guard lock(mutex);
+        order.push_back(name);
+    };
+
+    scheduler.pushWithPriority(TaskPriority::Background, record, "background");
+    scheduler.pushWithPriority(TaskPriority::Normal, record, "normal");
+    scheduler.pushWithPriority(TaskPriority::RealTime, record, "realtime");
+
+    release.set_value();
+    scheduler.waitForAllTasksComplete();
+
+    //! CHECK Higher priorities are taken first
+    std::vector<std::string> expected = { "realtime", "normal", "background" };
+    EXPECT_EQ(order, expected);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, BackgroundDoesNotOccupyAllThreads)
+{
+    //! GIVEN Scheduler with two threads
+    TaskScheduler scheduler(2);
+
+    //! DO Start more long background jobs than there are threads
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> startedBackground = 0;
+    for (int i = 0; i < 3; ++i) {
+        scheduler.pushWithPriority(TaskPriority::Background, [&startedBackground, released]() {
+            startedBackground++;
+            released.wait();
+        });
+    }
+
+    while (startedBackground == 0) {
+        std::this_thread::yield();
+    }
+
+    //! CHECK A real-time task still runs while the background jobs are blocked
+    std::future<int> realTime = scheduler.submitWithPriority(TaskPriority::RealTime, []() { return 1; });
+    ASSERT_EQ(realTime.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(realTime.get(), 1);
+    EXPECT_EQ(startedBackground, 1);
+
+    release.set_value();
+    scheduler.waitForAllTasksComplete();
+    EXPECT_EQ(startedBackground, 3);
+}
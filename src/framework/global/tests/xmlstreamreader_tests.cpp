@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "serialization/xmlstreamreader.h"
+
+using namespace mu;
+
+class Global_Ser_XmlStreamReaderTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Ser_XmlStreamReaderTests, Tokens)
+{
+    //! GIVEN Xml with declaration, comment, attributes, nested and empty elements
+    ByteArray data("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   "<museScore version=\"4.00\">\n"
+                   "  <!-- comment -->\n"
+                   "  <Score>\n"
+                   "    <Division>480</Division>\n"
+                   "    <Empty/>\n"
+                   "  </Score>\n"
+                   "</museScore>\n");
+
+    XmlStreamReader xml(data);
+
+    //! CHECK Tokens in document order
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::StartDocument);
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::StartElement);
+    EXPECT_EQ(xml.name(), "museScore");
+    EXPECT_EQ(xml.asciiAttribute("version"), "4.00");
+    EXPECT_EQ(xml.attribute("version"), u"4.00");
+    EXPECT_FALSE(xml.hasAttribute("other"));
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Comment);
+    EXPECT_EQ(xml.text(), u" comment ");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Score");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Division");
+    EXPECT_EQ(xml.readInt(), 480);
+    EXPECT_TRUE(xml.isEndElement());
+    EXPECT_EQ(xml.name(), "Division");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Empty");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "Empty");
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "Score");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "museScore");
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndDocument);
+    EXPECT_TRUE(xml.atEnd());
+    EXPECT_FALSE(xml.isError());
+    EXPECT_EQ(xml.lineNumber(), 9);
+}
+
+TEST_F(Global_Ser_XmlStreamReaderTests, TextAndEntities)
+{
+    //! GIVEN Xml with entities, character references and CDATA
+    ByteArray data("<a t=\"x &amp; y\">"
+                   "<b> 1 &lt; 2 &#x263A; &#65; &unknown; </b>"
+                   "<c><![CDATA[<raw> &amp;]]></c>"
+                   "</a>");
+
+    XmlStreamReader xml(data);
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.attribute("t"), u"x & y");
+
+    //! CHECK Entities are resolved, spaces around the text are kept
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.readText(), String::fromUtf8(" 1 < 2 \xE2\x98\xBA A &unknown; "));
+
+    //! CHECK CDATA is kept as is
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.readAsciiText(), "<raw> &amp;");
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "a");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndDocument);
+}
+
+TEST_F(Global_Ser_XmlStreamReaderTests, AsciiViewsStayValid)
+{
+    //! GIVEN Xml with several values
+    ByteArray data("<a><b>first</b><c v=\"second\">third</c></a>");
+
+    XmlStreamReader xml(data);
+
+    //! DO Read values and continue reading
+    xml.readNextStartElement();
+    xml.readNextStartElement();
+    AsciiStringView first = xml.readAsciiText();
+    xml.readNextStartElement();
+    AsciiStringView second = xml.asciiAttribute("v");
+    AsciiStringView third = xml.readAsciiText();
+    xml.skipCurrentElement();
+
+    //! CHECK The views still point to the right values
+    EXPECT_EQ(first, "first");
+    EXPECT_EQ(second, "second");
+    EXPECT_EQ(third, "third");
+
+    //! CHECK The source data was not modified
+    EXPECT_EQ(std::string(data.constChar()), "<a><b>first</b><c v=\"second\">third</c></a>");
+}
+
+TEST_F(Global_Ser_XmlStreamReaderTests, Errors)
+{
+    //! GIVEN Mismatched end element
+    {
+        XmlStreamReader xml(ByteArray("<a><b></a>"));
+        EXPECT_TRUE(xml.readNextStartElement());
+        EXPECT_TRUE(xml.readNextStartElement());
+        EXPECT_EQ(xml.readNext(), XmlStreamReader::Invalid);
+        EXPECT_EQ(xml.error(), XmlStreamReader::NotWellFormedError);
+        EXPECT_TRUE(xml.atEnd());
+    }
+
+    //! GIVEN Truncated document
+    {
+        XmlStreamReader xml(ByteArray("<a><b>text"));
+        EXPECT_TRUE(xml.readNextStartElement());
+        EXPECT_TRUE(xml.readNextStartElement());
+        xml.readText();
+        EXPECT_EQ(xml.error(), XmlStreamReader::PrematureEndOfDocumentError);
+    }
+
+    //! GIVEN Empty document
+    {
+        XmlStreamReader xml(ByteArray("  \n"));
+        EXPECT_EQ(xml.readNext(), XmlStreamReader::Invalid);
+        EXPECT_TRUE(xml.isError());
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "io/buffer.h"
+#include "serialization/zipreader.h"
+#include "serialization/zipwriter.h"
+
+using namespace mu;
+using namespace mu::io;
+
+class Global_Ser_ZipTests : public ::testing::Test
+{
+public:
+};
+
+static ByteArray textData()
+{
+    ByteArray data;
+    for (int i = 0; i < 1000; ++i) {
+        data.push_back(ByteArray("<Note><pitch>60</pitch></Note>\n"));
+    }
+    return data;
+}
+
+static ByteArray noiseData()
+{
+    ByteArray data;
+    data.resize(64 * 1024);
+    std::srand(42);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data.data()[i] = static_cast<uint8_t>(std::rand());
+    }
+    return data;
+}
+
+static ByteArray writeZip(const std::vector<std::pair<std::string, ByteArray> >& files)
+{
+    ByteArray zipData;
+    Buffer buf(&zipData);
+    buf.open(IODevice::WriteOnly);
+
+    ZipWriter zip(&buf);
+    for (const auto& f : files) {
+        zip.addFile(f.first, f.second);
+    }
+    zip.close();
+
+    return zipData;
+}
+
+TEST_F(Global_Ser_ZipTests, AddFile_RoundTrip)
+{
+    //! GIVEN Compressible and incompressible data
+    ByteArray text = textData();
+    ByteArray noise = noiseData();
+
+    //! DO Write them to the zip
+    ByteArray zipData = writeZip({ { "score.mscx", text }, { "Pictures/image.png", noise } });
+
+    //! CHECK The incompressible data is stored as is, not inflated by deflate
+    EXPECT_LT(zipData.size(), noise.size() + 512);
+
+    //! CHECK Read back
+    Buffer buf(&zipData);
+    ZipReader reader(&buf);
+    EXPECT_EQ(reader.fileData("score.mscx"), text);
+    EXPECT_EQ(reader.fileData("Pictures/image.png"), noise);
+}
+
+TEST_F(Global_Ser_ZipTests, AddFile_Store)
+{
+    //! GIVEN Compressible data
+    ByteArray text = textData();
+
+    //! DO Write it without compression
+    ByteArray zipData;
+    {
+        Buffer buf(&zipData);
+        buf.open(IODevice::WriteOnly);
+
+        ZipWriter zip(&buf);
+        zip.addFile("score.mscx", text, false);
+        zip.close();
+    }
+
+    //! CHECK The data is stored
+    EXPECT_GT(zipData.size(), text.size());
+
+    Buffer buf(&zipData);
+    ZipReader reader(&buf);
+    EXPECT_EQ(reader.fileData("score.mscx"), text);
+}
+
+TEST_F(Global_Ser_ZipTests, CopyFile)
+{
+    //! GIVEN Source zip
+    ByteArray text = textData();
+    ByteArray noise = noiseData();
+    ByteArray sourceData = writeZip({ { "score.mscx", text }, { "Pictures/image.png", noise } });
+
+    Buffer sourceBuf(&sourceData);
+    ZipReader source(&sourceBuf);
+
+    //! DO Copy files to a new zip
+    ByteArray changedText = text;
+    changedText.data()[0] = '!';
+
+    ByteArray zipData;
+    {
+        Buffer buf(&zipData);
+        buf.open(IODevice::WriteOnly);
+
+        ZipWriter zip(&buf);
+
+        //! CHECK Only the unchanged files are copied
+        EXPECT_FALSE(zip.copyFile(source, "score.mscx", changedText));
+        EXPECT_FALSE(zip.copyFile(source, "score.mscx", ByteArray("short")));
+        EXPECT_FALSE(zip.copyFile(source, "missing.png", noise));
+
+        EXPECT_TRUE(zip.copyFile(source, "score.mscx", text));
+        EXPECT_TRUE(zip.copyFile(source, "Pictures/image.png", noise));
+        zip.close();
+    }
+
+    //! CHECK The copied files are the same as in the source
+    EXPECT_EQ(zipData, sourceData);
+
+    //! CHECK Read back
+    Buffer buf(&zipData);
+    ZipReader reader(&buf);
+    EXPECT_EQ(reader.fileData("score.mscx"), text);
+    EXPECT_EQ(reader.fileData("Pictures/image.png"), noise);
+    EXPECT_EQ(reader.fileInfoList().size(), size_t(2));
+}
+
+TEST_F(Global_Ser_ZipTests, CopyFile_SameCrc)
+{
+    //! GIVEN Source zip with a deflated and a stored file
+    //! NOTE "plumless" and "buckeroo" have the same size and crc32
+    ByteArray sourceData;
+    {
+        Buffer buf(&sourceData);
+        buf.open(IODevice::WriteOnly);
+
+        ZipWriter zip(&buf);
+        zip.addFile("deflated.txt", ByteArray("plumless"), true);
+        zip.addFile("stored.txt", ByteArray("plumless"), false);
+        zip.close();
+    }
+
+    Buffer sourceBuf(&sourceData);
+    ZipReader source(&sourceBuf);
+
+    ByteArray zipData;
+    Buffer buf(&zipData);
+    buf.open(IODevice::WriteOnly);
+    ZipWriter zip(&buf);
+
+    //! CHECK The files with other contents are not copied
+    EXPECT_FALSE(zip.copyFile(source, "deflated.txt", ByteArray("buckeroo")));
+    EXPECT_FALSE(zip.copyFile(source, "stored.txt", ByteArray("buckeroo")));
+
+    //! CHECK The same files are copied
+    EXPECT_TRUE(zip.copyFile(source, "deflated.txt", ByteArray("plumless")));
+    EXPECT_TRUE(zip.copyFile(source, "stored.txt", ByteArray("plumless")));
+    zip.close();
+}
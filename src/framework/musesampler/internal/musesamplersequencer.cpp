@@ -105,13 +105,14 @@ void MuseSamplerSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& c
             ms_NoteArticulation articulationFlag = noteArticulationTypes(noteEvent);
 
             ms_AuditionStartNoteEvent noteOn = { pitch, articulationFlag, 0.5 };
-            m_offStreamEvents[timestampFrom].emplace(std::move(noteOn));
+            m_offStreamEvents.add(timestampFrom, std::move(noteOn));
 
             ms_AuditionStopNoteEvent noteOff = { pitch };
-            m_offStreamEvents[timestampTo].emplace(std::move(noteOff));
+            m_offStreamEvents.add(timestampTo, std::move(noteOff));
         }
     }
 
+    m_offStreamEvents.commit();
     updateOffSequenceIterator();
 }
 
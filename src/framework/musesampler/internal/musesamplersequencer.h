@@ -59,6 +59,7 @@ public:
     void init(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSampler sampler, ms_Track track);
 
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& changes) override;
+    using AbstractEventSequencer::updateMainStreamEvents;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateDynamicChanges(const mpe::DynamicLevelMap& changes) override;
 
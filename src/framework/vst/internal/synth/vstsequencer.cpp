@@ -45,7 +45,7 @@ void VstSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
     m_offStreamEvents.clear();
     m_offStreamFlushed.notify();
-    updatePlaybackEvents(m_offStreamEvents, changes);
+    updatePlaybackEvents(m_offStreamEvents, changes.cbegin(), changes.cend());
     updateOffSequenceIterator();
 }
 
@@ -53,7 +53,16 @@ void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
     m_mainStreamEvents.clear();
     m_mainStreamFlushed.notify();
-    updatePlaybackEvents(m_mainStreamEvents, changes);
+    updatePlaybackEvents(m_mainStreamEvents, changes.cbegin(), changes.cend());
+    updateMainSequenceIterator();
+}
+
+void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const audio::msecs_t changedFrom,
+                                          const audio::msecs_t changedTo)
+{
+    m_mainStreamEvents.removeSources(changedFrom, changedTo);
+    m_mainStreamFlushed.notify();
+    updatePlaybackEvents(m_mainStreamEvents, events.lower_bound(changedFrom), events.upper_bound(changedTo));
     updateMainSequenceIterator();
 }
 
@@ -62,9 +71,10 @@ void VstSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
     m_dynamicEvents.clear();
 
     for (const auto& pair : changes) {
-        m_dynamicEvents[pair.first].emplace(expressionLevel(pair.second));
+        m_dynamicEvents.add(pair.first, expressionLevel(pair.second));
     }
 
+    m_dynamicEvents.commit();
     updateDynamicChangesIterator();
 }
 
@@ -74,10 +84,13 @@ audio::gain_t VstSequencer::currentGain() const
     return expressionLevel(currentDynamicLevel);
 }
 
-void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void VstSequencer::updatePlaybackEvents(Timeline& destination, mpe::PlaybackEventsMap::const_iterator first,
+                                        mpe::PlaybackEventsMap::const_iterator last)
 {
-    for (const auto& pair : changes) {
-        for (const mpe::PlaybackEvent& event : pair.second) {
+    for (auto it = first; it != last; ++it) {
+        destination.setSourceTimestamp(it->first);
+
+        for (const mpe::PlaybackEvent& event : it->second) {
             if (!std::holds_alternative<mpe::NoteEvent>(event)) {
                 continue;
             }
@@ -91,15 +104,17 @@ void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe
             float velocityFraction = noteVelocityFraction(noteEvent);
             float tuning = noteTuning(noteEvent, noteId);
 
-            destination[timestampFrom].emplace(buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
-            destination[timestampTo].emplace(buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampFrom, buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampTo, buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, SUSTAIN_IDX);
         }
     }
+
+    destination.commit();
 }
 
-void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                        const mpe::ArticulationTypeSet& appliableTypes, const ControllIdx controlIdx)
 {
     auto controlIt = m_mapping.find(controlIdx);
@@ -120,10 +135,10 @@ void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe:
         const mpe::ArticulationAppliedData& articulationData = noteEvent.expressionCtx().articulations.at(currentType);
         const mpe::ArticulationMeta& articulationMeta = articulationData.meta;
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 1 /*on*/));
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 1 /*on*/));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, buildParamInfo(controlIt->second, 0 /*off*/));
     } else {
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 0 /*off*/));
     }
 }
 
@@ -61,14 +61,17 @@ public:
 
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) override;
+    void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const audio::msecs_t changedFrom,
+                                const audio::msecs_t changedTo) override;
     void updateDynamicChanges(const mpe::DynamicLevelMap& changes) override;
 
     audio::gain_t currentGain() const;
 
 private:
-    void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes);
+    void updatePlaybackEvents(Timeline& destination, mpe::PlaybackEventsMap::const_iterator first,
+                              mpe::PlaybackEventsMap::const_iterator last);
 
-    void appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
+    void appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                              const ControllIdx controlIdx);
 
     VstEvent buildEvent(const Steinberg::Vst::Event::EventTypes type, const int32_t noteIdx, const float velocityFraction,
@@ -41,6 +41,14 @@ public:
     virtual int exportSampleRate() const = 0;
     virtual void setExportSampleRate(int rate) = 0;
     virtual const std::vector<int>& availableSampleRates() const = 0;
+
+    //! NOTE Also write every instrument track to its own file, next to the master mix
+    virtual bool exportStems() const = 0;
+    virtual void setExportStems(bool stems) = 0;
+
+    //! NOTE The metronome and the chord symbols tracks are written as stems only on request
+    virtual bool exportAuxStems() const = 0;
+    virtual void setExportAuxStems(bool aux) = 0;
 };
 }
 
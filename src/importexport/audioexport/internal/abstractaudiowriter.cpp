@@ -21,6 +21,8 @@
  */
 #include "abstractaudiowriter.h"
 
+#include <algorithm>
+
 #include <QThread>
 
 #include "log.h"
@@ -98,8 +100,17 @@ void AbstractAudioWriter::doWriteAndWait(QIODevice& destinationDevice, const aud
 
     m_isCompleted = false;
 
+    //! NOTE The events loop below would keep loading the playback data while the sound track is being rendered
+    IMasterNotationPtr masterNotation = globalContext()->currentMasterNotation();
+    if (masterNotation) {
+        masterNotation->playback()->finishLoading();
+    }
+
+    bool stems = configuration()->exportStems();
+    audio::TrackIdList stemTrackIds = stems ? stemTrackIdList() : audio::TrackIdList();
+
     playback()->sequenceIdList()
-    .onResolve(this, [this, path, &format](const audio::TrackSequenceIdList& sequenceIdList) {
+    .onResolve(this, [this, path, &format, stems, stemTrackIds](const audio::TrackSequenceIdList& sequenceIdList) {
         m_progress.started.notify();
 
         for (const audio::TrackSequenceId sequenceId : sequenceIdList) {
@@ -108,8 +119,11 @@ void AbstractAudioWriter::doWriteAndWait(QIODevice& destinationDevice, const aud
                 m_progress.progressChanged.send(current, total, title);
             });
 
-            playback()->audioOutput()->saveSoundTrack(sequenceId, io::path_t(path), std::move(format))
-            .onResolve(this, [this, path](const bool /*result*/) {
+            mu::async::Promise<bool> save = stems
+                                        ? playback()->audioOutput()->saveSoundTrackStems(sequenceId, io::path_t(path), format, stemTrackIds)
+                                        : playback()->audioOutput()->saveSoundTrack(sequenceId, io::path_t(path), format);
+
+            save.onResolve(this, [this, path](const bool /*result*/) {
                 LOGD() << "Successfully saved sound track by path: " << path;
                 m_isCompleted = true;
                 m_progress.finished.send(make_ok());
@@ -145,3 +159,27 @@ INotationWriter::UnitType AbstractAudioWriter::unitTypeFromOptions(const Options
 
     return unitType;
 }
+
+mu::audio::TrackIdList AbstractAudioWriter::stemTrackIdList() const
+{
+    audio::TrackIdList result;
+
+    IMasterNotationPtr masterNotation = globalContext()->currentMasterNotation();
+    INotationPlaybackPtr notationPlayback = masterNotation ? masterNotation->playback() : nullptr;
+    bool withAux = configuration()->exportAuxStems();
+
+    for (const auto& pair : playbackController()->instrumentTrackIdMap()) {
+        bool isAux = notationPlayback && (pair.first == notationPlayback->metronomeTrackId()
+                                          || notationPlayback->isChordSymbolsTrack(pair.first));
+        if (isAux && !withAux) {
+            continue;
+        }
+
+        result.push_back(pair.second);
+    }
+
+    //! NOTE The stems of the repeated track names are numbered in this order
+    std::sort(result.begin(), result.end());
+
+    return result;
+}
@@ -26,6 +26,8 @@
 #include "audio/iplayback.h"
 #include "audio/iaudiooutput.h"
 #include "async/asyncable.h"
+#include "context/iglobalcontext.h"
+#include "playback/iplaybackcontroller.h"
 #include "iaudioexportconfiguration.h"
 
 #include "project/inotationwriter.h"
@@ -35,6 +37,8 @@ class AbstractAudioWriter : public project::INotationWriter, public async::Async
 {
     INJECT(audioexport, audio::IPlayback, playback)
     INJECT(audioexport, IAudioExportConfiguration, configuration)
+    INJECT(audioexport, context::IGlobalContext, globalContext)
+    INJECT(audioexport, playback::IPlaybackController, playbackController)
 
 public:
     std::vector<UnitType> supportedUnitTypes() const override;
@@ -51,6 +55,8 @@ protected:
     void doWriteAndWait(QIODevice& destinationDevice, const audio::SoundTrackFormat& format);
 
     UnitType unitTypeFromOptions(const Options& options) const;
+    audio::TrackIdList stemTrackIdList() const;
+
     framework::Progress m_progress;
     bool m_isCompleted = false;
 };
@@ -38,8 +38,16 @@ public:
     void setExportSampleRate(int rate) override;
     const std::vector<int>& availableSampleRates() const override;
 
+    bool exportStems() const override;
+    void setExportStems(bool stems) override;
+
+    bool exportAuxStems() const override;
+    void setExportAuxStems(bool aux) override;
+
 private:
     std::optional<int> m_exportMp3Bitrate = std::nullopt;
+    bool m_exportStems = false;
+    bool m_exportAuxStems = false;
 };
 }
 
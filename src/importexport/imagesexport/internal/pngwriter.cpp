@@ -68,6 +68,7 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
     opt.printPageBackground = false; //Already printed
+    opt.isSetupDrawSystem = !options.value(OptionKey::DRAW_SYSTEM_READY, Val(false)).toBool();
 
     notation->painting()->paintPng(&painter, opt);
 
@@ -75,3 +76,18 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
 
     return true;
 }
+
+bool PngWriter::supportsParallelPageWrite() const
+{
+    return true;
+}
+
+void PngWriter::beginParallelPageWrite(INotationPtr notation, Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return;
+    }
+
+    notation->painting()->setupDrawSystem(configuration()->exportPngDpiResolution(), true);
+    options[OptionKey::DRAW_SYSTEM_READY] = Val(true);
+}
@@ -36,6 +36,9 @@ class PngWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
+
+    bool supportsParallelPageWrite() const override;
+    void beginParallelPageWrite(notation::INotationPtr notation, Options& options) override;
 };
 }
 
@@ -58,19 +58,20 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
-    score->setPrinting(true); // don’t print page break symbols etc.
-
-    mu::engraving::MScore::pdfPrinting = true;
-    mu::engraving::MScore::svgPrinting = true;
-
     const std::vector<mu::engraving::Page*>& pages = score->pages();
-    double pixelRationBackup = mu::engraving::MScore::pixelRatio;
 
     const size_t PAGE_NUMBER = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
     if (PAGE_NUMBER >= pages.size()) {
         return false;
     }
 
+    //! NOTE If the draw system is ready, other pages may be written at the same time,
+    //! so nothing shared by them can be changed here
+    const bool DRAW_SYSTEM_READY = options.value(OptionKey::DRAW_SYSTEM_READY, Val(false)).toBool();
+    if (!DRAW_SYSTEM_READY) {
+        setupDrawSystem(score);
+    }
+
     mu::engraving::Page* page = pages.at(PAGE_NUMBER);
 
     SvgGenerator printer;
@@ -96,8 +97,6 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         painter.translate(-pageRect.topLeft());
     }
 
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / printer.logicalDpiX();
-
     if (!options[OptionKey::TRANSPARENT_BACKGROUND].toBool()) {
         painter.fillRect(pageRect, mu::draw::Color::white);
     }
@@ -149,53 +148,25 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                     }
                 }
             } else {   // Draw staff lines once per system
-                mu::engraving::StaffLines* firstSL = system->firstMeasure()->staffLines(static_cast<int>(staffIndex))->clone();
+                mu::engraving::StaffLines* firstSL = system->firstMeasure()->staffLines(static_cast<int>(staffIndex));
                 mu::engraving::StaffLines* lastSL =  system->lastMeasure()->staffLines(static_cast<int>(staffIndex));
 
                 qreal lastX =  lastSL->bbox().right()
                               + lastSL->pagePos().x()
                               - firstSL->pagePos().x();
-                std::vector<mu::LineF>& lines = firstSL->getLines();
-                for (size_t l = 0, c = lines.size(); l < c; l++) {
-                    lines[l].setP2(mu::PointF(lastX, lines[l].p2().y()));
-                }
 
+                mu::PointF firstSLPos = firstSL->pagePos();
                 printer.setElement(firstSL);
-                engraving::Paint::paintElement(painter, firstSL);
+                painter.translate(firstSLPos);
+                firstSL->drawStretched(&painter, lastX);
+                painter.translate(-firstSLPos);
             }
         }
     }
 
-    BeatsColors beatsColors = parseBeatsColors(options.value(OptionKey::BEATS_COLORS, Val()).toQVariant());
-
     // 2nd pass: Set color for elements on beats
-    int beatIndex = 0;
-    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
-        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
-            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
-                    continue;
-                }
-
-                if (beatsColors.contains(beatIndex)) {
-                    for (EngravingItem* element : segment->elist()) {
-                        if (!element) {
-                            continue;
-                        }
-
-                        if (element->isChord()) {
-                            for (Note* note : toChord(element)->notes()) {
-                                note->setColor(beatsColors[beatIndex]);
-                            }
-                        } else if (element->isChordRest()) {
-                            element->setColor(beatsColors[beatIndex]);
-                        }
-                    }
-                }
-
-                beatIndex++;
-            }
-        }
+    if (!DRAW_SYSTEM_READY) {
+        colorBeats(score, options);
     }
 
     // 3rd pass: the rest of the elements
@@ -227,12 +198,97 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     painter.endDraw(); // Writes MuseScore SVG file to disk, finally
 
     // Clean up and return
-    mu::engraving::MScore::pixelRatio = pixelRationBackup;
+    if (!DRAW_SYSTEM_READY) {
+        resetDrawSystem(score);
+    }
+
+    return true;
+}
+
+bool SvgWriter::supportsParallelPageWrite() const
+{
+    return true;
+}
+
+void SvgWriter::beginParallelPageWrite(INotationPtr notation, Options& options)
+{
+    IF_ASSERT_FAILED(notation && notation->elements()->msScore()) {
+        return;
+    }
+
+    //! NOTE Resolve the configuration here, so that it isn't resolved by several page threads at the same time
+    configuration();
+
+    mu::engraving::Score* score = notation->elements()->msScore();
+    setupDrawSystem(score);
+    colorBeats(score, options);
+
+    options[OptionKey::DRAW_SYSTEM_READY] = Val(true);
+}
+
+void SvgWriter::endParallelPageWrite(INotationPtr notation, const Options&)
+{
+    IF_ASSERT_FAILED(notation && notation->elements()->msScore()) {
+        return;
+    }
+
+    resetDrawSystem(notation->elements()->msScore());
+}
+
+void SvgWriter::setupDrawSystem(mu::engraving::Score* score)
+{
+    score->setPrinting(true); // don’t print page break symbols etc.
+
+    mu::engraving::MScore::pdfPrinting = true;
+    mu::engraving::MScore::svgPrinting = true;
+
+    m_pixelRatioBackup = mu::engraving::MScore::pixelRatio;
+    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / SvgGenerator().logicalDpiX();
+}
+
+void SvgWriter::resetDrawSystem(mu::engraving::Score* score)
+{
+    mu::engraving::MScore::pixelRatio = m_pixelRatioBackup;
     score->setPrinting(false);
     mu::engraving::MScore::pdfPrinting = false;
     mu::engraving::MScore::svgPrinting = false;
+}
 
-    return true;
+void SvgWriter::colorBeats(mu::engraving::Score* score, const Options& options) const
+{
+    BeatsColors beatsColors = parseBeatsColors(options.value(OptionKey::BEATS_COLORS, Val()).toQVariant());
+    if (beatsColors.isEmpty()) {
+        return;
+    }
+
+    int beatIndex = 0;
+    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
+        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
+            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
+                if (!segment->isChordRestType()) {
+                    continue;
+                }
+
+                if (beatsColors.contains(beatIndex)) {
+                    for (EngravingItem* element : segment->elist()) {
+                        if (!element) {
+                            continue;
+                        }
+
+                        if (element->isChord()) {
+                            for (Note* note : toChord(element)->notes()) {
+                                note->setColor(beatsColors[beatIndex]);
+                            }
+                        } else if (element->isChordRest()) {
+                            element->setColor(beatsColors[beatIndex]);
+                        }
+                    }
+                }
+
+                beatIndex++;
+            }
+        }
+    }
 }
 
 SvgWriter::BeatsColors SvgWriter::parseBeatsColors(const QVariant& obj) const
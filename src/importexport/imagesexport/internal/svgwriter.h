@@ -28,6 +28,10 @@
 #include "modularity/ioc.h"
 #include "iimagesexportconfiguration.h"
 
+namespace mu::engraving {
+class Score;
+}
+
 namespace mu::iex::imagesexport {
 class SvgWriter : public AbstractImageWriter
 {
@@ -37,10 +41,20 @@ public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
 
+    bool supportsParallelPageWrite() const override;
+    void beginParallelPageWrite(notation::INotationPtr notation, Options& options) override;
+    void endParallelPageWrite(notation::INotationPtr notation, const Options& options) override;
+
 private:
     using BeatsColors = QHash<int /* beatIndex */, QColor>;
 
+    void setupDrawSystem(mu::engraving::Score* score);
+    void resetDrawSystem(mu::engraving::Score* score);
+    void colorBeats(mu::engraving::Score* score, const Options& options) const;
+
     BeatsColors parseBeatsColors(const QVariant& obj) const;
+
+    double m_pixelRatioBackup = 0.0;
 };
 }
 
@@ -25,6 +25,7 @@
 #include <QString>
 
 #include "async/notification.h"
+#include "async/channel.h"
 #include "internal/inotationundostack.h"
 #include "notationtypes.h"
 #include "inotationpainting.h"
@@ -96,6 +97,10 @@ public:
 
     // notify
     virtual async::Notification notationChanged() const = 0;
+
+    //! NOTE The area of the score to redraw after an update without layout (ex. a selection change), in canvas coordinates.
+    //! An empty rect means the whole score
+    virtual async::Channel<RectF> notationAreaChanged() const = 0;
 };
 }
 
@@ -36,8 +36,11 @@ public:
     struct Options
     {
         bool isSetViewport = true;
+        bool isSetupDrawSystem = true; // false if setupDrawSystem was already called, ex. to paint pages from several threads
         bool isPrinting = false;
         bool isMultiPage = false;
+        bool isUseDisplayList = false; // replay the recorded draw commands of the pages, see PageDisplayList
+        bool isPaintInteraction = true; // selection, grips, text cursor and etc, not painted if isPrinting
         bool printPageBackground = true;
         RectF frameRect;
         int fromPage = -1; // 0 is first
@@ -55,7 +58,21 @@ public:
     virtual int pageCount() const = 0;
     virtual SizeF pageSizeInch() const = 0;
 
+    //! NOTE Sets the state shared by all pages (pixel ratio, printing mode),
+    //! painting with isSetupDrawSystem = false does not change it and can be done for several pages at once
+    virtual void setupDrawSystem(int deviceDpi, bool isPrinting) = 0;
+
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE To paint the view by parts (ex. by tiles): the pages without the interaction, then the interaction on top.
+    //! prepareViewPages takes a snapshot of the pages in frameRect for the current draw system (see setupDrawSystem)
+    //! and returns a function that paints it without the score, so it can be called from any thread, also while the notation is changed.
+    //! Returns nullptr if the pages can only be painted by paintViewPages in the main thread
+    using PaintPagesFunc = std::function<void (draw::Painter* painter, const RectF& frameRect)>;
+    virtual PaintPagesFunc prepareViewPages(const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewPages(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewInteraction(draw::Painter* painter, bool isPrinting) = 0;
+
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
@@ -48,6 +48,10 @@ public:
     virtual void triggerEventsForItems(const std::vector<const EngravingItem*>& items) = 0;
     virtual void triggerMetronome(int tick) = 0;
 
+    //! NOTE The playback data is loaded in chunks on the next event loop iterations,
+    //!      an offline render of the whole score must finish the load first
+    virtual void finishLoading() = 0;
+
     virtual engraving::InstrumentTrackIdSet existingTrackIdSet() const = 0;
     virtual async::Channel<engraving::InstrumentTrackId> trackAdded() const = 0;
     virtual async::Channel<engraving::InstrumentTrackId> trackRemoved() const = 0;
@@ -45,6 +45,12 @@ void ExcerptNotation::init()
         return;
     }
 
+    //! NOTE The unloaded excerpt is initialized when its score is requested for the first time, see score()
+    if (!m_excerpt->isLoaded()) {
+        m_deferred = true;
+        return;
+    }
+
     setScore(m_excerpt->excerptScore());
 
     if (isEmpty()) {
@@ -61,6 +67,10 @@ bool ExcerptNotation::isCustom() const
 
 bool ExcerptNotation::isEmpty() const
 {
+    if (m_deferred) {
+        return false;
+    }
+
     return m_excerpt->parts().empty();
 }
 
@@ -136,8 +146,31 @@ INotationPtr ExcerptNotation::notation()
     return shared_from_this();
 }
 
+mu::engraving::Score* ExcerptNotation::score() const
+{
+    if (m_deferred) {
+        ExcerptNotation* self = const_cast<ExcerptNotation*>(this);
+        self->m_deferred = false;
+        self->m_excerpt->load();
+        self->init();
+    }
+
+    return Notation::score();
+}
+
+bool ExcerptNotation::isOpen() const
+{
+    if (m_deferred) {
+        return m_excerpt->isOpen();
+    }
+
+    return Notation::isOpen();
+}
+
 IExcerptNotationPtr ExcerptNotation::clone() const
 {
+    m_excerpt->load();
+
     mu::engraving::Excerpt* copy = new mu::engraving::Excerpt(*m_excerpt);
     return std::make_shared<ExcerptNotation>(copy);
 }
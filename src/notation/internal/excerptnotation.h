@@ -48,11 +48,15 @@ public:
     INotationPtr notation() override;
     IExcerptNotationPtr clone() const override;
 
+    mu::engraving::Score* score() const override;
+    bool isOpen() const override;
+
 private:
     void fillWithDefaultInfo();
 
     mu::engraving::Excerpt* m_excerpt = nullptr;
     bool m_inited = false;
+    bool m_deferred = false;
 };
 }
 
@@ -23,6 +23,7 @@
 
 #include <QFileInfo>
 
+#include "async/async.h"
 #include "log.h"
 #include "translation.h"
 
@@ -116,6 +117,29 @@ void MasterNotation::setMasterScore(mu::engraving::MasterScore* score)
     score->updateSwing();
     m_notationPlayback->init(m_undoStack);
     initExcerptNotations(masterScore()->excerpts());
+
+    //! NOTE The unloaded excerpts are loaded on the first edit of the score (see Score::startCmd),
+    //! so they are loaded one by one while the application is idle, to not do it all at once on the first edit
+    async::Async::call(this, [this]() {
+        loadNextExcerpt();
+    });
+}
+
+void MasterNotation::loadNextExcerpt()
+{
+    for (mu::engraving::Excerpt* excerpt : masterScore()->excerpts()) {
+        if (excerpt->isLoaded()) {
+            continue;
+        }
+
+        excerpt->load();
+
+        async::Async::call(this, [this]() {
+            loadNextExcerpt();
+        });
+
+        return;
+    }
 }
 
 mu::engraving::MasterScore* MasterNotation::masterScore() const
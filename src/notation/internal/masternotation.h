@@ -80,6 +80,7 @@ private:
 
     void updatePotentialExcerpts() const;
     void initExcerptNotations(const std::vector<mu::engraving::Excerpt*>& excerpts);
+    void loadNextExcerpt();
     void addExcerptsToMasterScore(const std::vector<mu::engraving::Excerpt*>& excerpts);
     void doSetExcerpts(ExcerptNotationList excerpts);
     void updateExcerpts();
@@ -90,6 +90,35 @@ Notation::Notation(mu::engraving::Score* score)
         notifyAboutNotationChanged();
     });
 
+    //! NOTE The recorded draw commands of the pages are valid until something changes the drawing
+    m_notationChanged.onNotify(this, [this]() {
+        m_painting->invalidateDisplayLists();
+    });
+
+    //! NOTE Only the pages with the elements that were or became selected are drawn differently
+    m_interaction->selectionChanged().onNotify(this, [this]() {
+        std::set<const mu::engraving::Page*> selectionPages;
+        for (const EngravingItem* item : m_interaction->selection()->elements()) {
+            if (const EngravingItem* page = item->findAncestor(mu::engraving::ElementType::PAGE)) {
+                selectionPages.insert(static_cast<const mu::engraving::Page*>(page));
+            }
+        }
+
+        std::set<const mu::engraving::Page*> changedPages = m_selectionPages;
+        changedPages.insert(selectionPages.begin(), selectionPages.end());
+        m_painting->invalidateDisplayLists(changedPages);
+
+        m_selectionPages = std::move(selectionPages);
+    });
+
+    engravingConfiguration()->scoreInversionChanged().onNotify(this, [this]() {
+        m_painting->invalidateDisplayLists();
+    });
+
+    engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        m_painting->invalidateDisplayLists();
+    });
+
     configuration()->canvasOrientation().ch.onReceive(this, [this](framework::Orientation) {
         if (m_score) {
             m_score->doLayout();
@@ -97,6 +126,8 @@ Notation::Notation(mu::engraving::Score* score)
                 score->doLayout();
             }
         }
+
+        m_painting->invalidateDisplayLists();
     });
 
     setScore(score);
@@ -135,6 +166,7 @@ void Notation::setScore(mu::engraving::Score* score)
     }
 
     m_score = score;
+    m_refreshListener.setScore(score);
     m_scoreInited.notify();
 }
 
@@ -284,6 +316,11 @@ mu::async::Notification Notation::notationChanged() const
     return m_notationChanged;
 }
 
+mu::async::Channel<mu::RectF> Notation::notationAreaChanged() const
+{
+    return m_refreshListener.areaChanged();
+}
+
 INotationAccessibilityPtr Notation::accessibility() const
 {
     return m_accessibility;
@@ -22,21 +22,26 @@
 #ifndef MU_NOTATION_NOTATION_H
 #define MU_NOTATION_NOTATION_H
 
+#include <set>
+
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "iengravingconfiguration.h"
 
 #include "../inotation.h"
 #include "igetscore.h"
+#include "scorerefreshlistener.h"
 #include "../inotationconfiguration.h"
 
 namespace mu::engraving {
+class Page;
 class Score;
 }
 
 namespace mu::notation {
 class NotationInteraction;
 class NotationPlayback;
+class NotationPainting;
 class Notation : virtual public INotation, public IGetScore, public async::Asyncable
 {
     INJECT_STATIC(notation, INotationConfiguration, configuration)
@@ -74,6 +79,7 @@ public:
     INotationPartsPtr parts() const override;
 
     async::Notification notationChanged() const override;
+    async::Channel<RectF> notationAreaChanged() const override;
 
 protected:
     mu::engraving::Score* score() const override;
@@ -95,7 +101,10 @@ private:
 
     async::Notification m_openChanged;
 
-    INotationPaintingPtr m_painting = nullptr;
+    ScoreRefreshListener m_refreshListener;
+
+    std::shared_ptr<NotationPainting> m_painting = nullptr;
+    std::set<const mu::engraving::Page*> m_selectionPages; // the pages with the selected elements
     INotationViewStatePtr m_viewState = nullptr;
     INotationInteractionPtr m_interaction = nullptr;
     INotationStylePtr m_style = nullptr;
@@ -37,6 +37,15 @@ using namespace mu::notation;
 using namespace mu::engraving;
 using namespace mu::draw;
 
+static bool isTextWorkaroundAllowed()
+{
+#ifndef Q_OS_MACOS
+    return !MScore::pdfPrinting;
+#else
+    return false;
+#endif
+}
+
 NotationPainting::NotationPainting(Notation* notation)
     : m_notation(notation)
 {
@@ -143,10 +152,9 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
         painter->setWindow(RectF(0.0, 0.0, pageSize.width() * mu::engraving::DPI, pageSize.height() * mu::engraving::DPI));
     }
 
-    // Setup score draw system
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / DEVICE_DPI;
-    score()->setPrinting(opt.isPrinting);
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    if (opt.isSetupDrawSystem) {
+        setupDrawSystem(DEVICE_DPI, opt.isPrinting);
+    }
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
@@ -202,8 +210,7 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             // Draw page elements
             painter->setClipping(true);
             painter->setClipRect(pageRect);
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+            paintPageElements(painter, page, drawRect.translated(-pagePos), opt);
             painter->setClipping(false);
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
@@ -225,52 +232,89 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             }
         }
 
-        if (!opt.isPrinting) {
-            static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+        if (opt.isPaintInteraction) {
+            paintViewInteraction(painter, opt.isPrinting);
         }
     }
 }
 
+void NotationPainting::setupDrawSystem(int deviceDpi, bool isPrinting)
+{
+    if (!score()) {
+        return;
+    }
+
+    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / (deviceDpi > 0 ? deviceDpi : mu::engraving::DPI);
+    score()->setPrinting(isPrinting);
+    mu::engraving::MScore::pdfPrinting = isPrinting;
+}
+
 void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                                       bool printPageBackground) const
 {
     TRACEFUNC;
-    if (score()->printing()) {
-        if (!printPageBackground) {
-            return;
-        }
-
-        painter->fillRect(pageRect, Color::white);
-        return;
-    }
+    PageSheetStyle style = pageSheetStyle(printPageBackground);
 
-    if (configuration()->foregroundUseColor()) {
-        painter->fillRect(pageRect, configuration()->foregroundColor());
-    } else {
+    if (!score()->printing() && !configuration()->foregroundUseColor()) {
         const QPixmap& wallpaper = configuration()->foregroundWallpaper();
         if (!wallpaper.isNull()) {
             painter->drawTiledPixmap(pageRect, wallpaper);
-        } else {
-            //! NOTE We can use the color from the configuration,
-            //! but in this case I believe it is better to use the "unassigned" color
-            painter->fillRect(pageRect, Color::white);
+            style.isFill = false;
         }
     }
 
+    paintPageSheet(painter, style, pageRect, pageContentRect, isOdd);
+}
+
+NotationPainting::PageSheetStyle NotationPainting::pageSheetStyle(bool printPageBackground) const
+{
+    PageSheetStyle style;
+
+    if (score()->printing()) {
+        style.isFill = printPageBackground;
+        style.fillColor = Color::white;
+        return style;
+    }
+
+    //! NOTE We can use the color from the configuration,
+    //! but in this case I believe it is better to use the "unassigned" color
+    style.isFill = true;
+    style.fillColor = configuration()->foregroundUseColor() ? configuration()->foregroundColor() : Color::white;
+
     if (!isPaintPageBorder()) {
+        return style;
+    }
+
+    style.isBorder = true;
+    style.borderPen = Pen(configuration()->borderColor(), configuration()->borderWidth());
+
+    style.isContentBorder = score()->showPageborders();
+    style.contentBorderColor = engravingConfiguration()->formattingMarksColor();
+
+    return style;
+}
+
+void NotationPainting::paintPageSheet(Painter* painter, const PageSheetStyle& style, const RectF& pageRect,
+                                      const RectF& pageContentRect, bool isOdd)
+{
+    if (style.isFill) {
+        painter->fillRect(pageRect, style.fillColor);
+    }
+
+    if (!style.isBorder) {
         return;
     }
 
     painter->setBrush(BrushStyle::NoBrush);
-    painter->setPen(Pen(configuration()->borderColor(), configuration()->borderWidth()));
+    painter->setPen(style.borderPen);
     painter->drawRect(pageRect);
 
-    if (!score()->showPageborders()) {
+    if (!style.isContentBorder) {
         return;
     }
 
     painter->setBrush(BrushStyle::NoBrush);
-    painter->setPen(engravingConfiguration()->formattingMarksColor());
+    painter->setPen(style.contentBorderColor);
     painter->drawRect(pageContentRect);
 
     if (!isOdd) {
@@ -278,17 +322,170 @@ void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, c
     }
 }
 
+void NotationPainting::paintPageElements(Painter* painter, Page* page, const RectF& rect, const Options& opt)
+{
+    if (!opt.isUseDisplayList) {
+        std::vector<EngravingItem*> elements = page->items(rect);
+        engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+        return;
+    }
+
+    displayList(page, opt.isPrinting)->paint(painter, rect, isTextWorkaroundAllowed());
+
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    if (!opt.isPrinting) {
+        engraving::DebugPaint::paintElementsDebug(*painter, page->items(rect));
+    }
+#endif
+}
+
+std::shared_ptr<const PageDisplayList> NotationPainting::displayList(const Page* page, bool isPrinting)
+{
+    //! NOTE The recorded commands depend on the draw system
+    if (m_displayListsPixelRatio != MScore::pixelRatio || m_displayListsPrinting != isPrinting) {
+        invalidateDisplayLists();
+        m_displayListsPixelRatio = MScore::pixelRatio;
+        m_displayListsPrinting = isPrinting;
+    }
+
+    std::shared_ptr<const PageDisplayList>& list = m_displayLists[page];
+    if (!list) {
+        auto newList = std::make_shared<PageDisplayList>();
+        newList->build(const_cast<Page*>(page));
+        list = newList;
+    }
+
+    return list;
+}
+
+void NotationPainting::invalidateDisplayLists()
+{
+    m_displayLists.clear();
+}
+
+void NotationPainting::invalidateDisplayLists(const std::set<const Page*>& pages)
+{
+    for (const Page* page : pages) {
+        m_displayLists.erase(page);
+    }
+}
+
+bool NotationPainting::isPageSheetThreadSafe() const
+{
+    //! NOTE The wallpaper is a QPixmap, it can be used only in the main thread
+    if (score()->printing() || configuration()->foregroundUseColor()) {
+        return true;
+    }
+
+    return configuration()->foregroundWallpaper().isNull();
+}
+
 void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
 {
     Options opt;
     opt.isSetViewport = false;
     opt.isMultiPage = true;
+    opt.isUseDisplayList = true;
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
     doPaint(painter, opt);
 }
 
+INotationPainting::PaintPagesFunc NotationPainting::prepareViewPages(const RectF& frameRect, bool isPrinting)
+{
+    TRACEFUNC;
+    if (!score()) {
+        return nullptr;
+    }
+
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    //! NOTE The debug painting needs the score
+    return nullptr;
+#endif
+
+    if (!isPageSheetThreadSafe()) {
+        return nullptr;
+    }
+
+    struct ViewPage {
+        PointF pos;
+        RectF rect;
+        RectF contentRect;
+        bool isOdd = false;
+        std::shared_ptr<const PageDisplayList> displayList;
+    };
+
+    std::vector<ViewPage> viewPages;
+
+    for (const Page* page : score()->pages()) {
+        if (!page->canvasBoundingRect().intersects(frameRect)) {
+            continue;
+        }
+
+        std::shared_ptr<const PageDisplayList> list = displayList(page, isPrinting);
+
+        //! NOTE Images are painted directly, they are converted to QPixmap, that can be used only in the main thread
+        if (list->hasLiveItems()) {
+            return nullptr;
+        }
+
+        ViewPage viewPage;
+        viewPage.pos = page->pos();
+        viewPage.rect = page->bbox();
+        viewPage.contentRect = viewPage.rect.adjusted(page->lm(), page->tm(), -page->rm(), -page->bm());
+        viewPage.isOdd = page->isOdd();
+        viewPage.displayList = list;
+        viewPages.push_back(std::move(viewPage));
+    }
+
+    PageSheetStyle sheetStyle = pageSheetStyle(true);
+    bool textWorkaroundAllowed = isTextWorkaroundAllowed();
+
+    return [viewPages, sheetStyle, textWorkaroundAllowed](Painter* painter, const RectF& rect) {
+        painter->setAntialiasing(true);
+
+        for (const ViewPage& page : viewPages) {
+            if (!page.rect.translated(page.pos).intersects(rect)) {
+                continue;
+            }
+
+            painter->translate(page.pos);
+
+            paintPageSheet(painter, sheetStyle, page.rect, page.contentRect, page.isOdd);
+
+            painter->setClipping(true);
+            painter->setClipRect(page.rect);
+            page.displayList->paint(painter, rect.translated(-page.pos), textWorkaroundAllowed);
+            painter->setClipping(false);
+
+            painter->translate(-page.pos);
+        }
+    };
+}
+
+void NotationPainting::paintViewPages(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    Options opt;
+    opt.isSetViewport = false;
+    opt.isSetupDrawSystem = false;
+    opt.isMultiPage = true;
+    opt.isUseDisplayList = true;
+    opt.isPaintInteraction = false;
+    opt.frameRect = frameRect;
+    opt.isPrinting = isPrinting;
+    doPaint(painter, opt);
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter, bool isPrinting)
+{
+    if (!score() || isPrinting) {
+        return;
+    }
+
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
 {
     Q_ASSERT(opt.deviceDpi > 0);
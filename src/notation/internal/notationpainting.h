@@ -22,8 +22,13 @@
 #ifndef MU_NOTATION_NOTATIONPAINTING_H
 #define MU_NOTATION_NOTATIONPAINTING_H
 
+#include <map>
+#include <memory>
+#include <set>
+
 #include "../inotationpainting.h"
 #include "igetscore.h"
+#include "pagedisplaylist.h"
 
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
@@ -52,12 +57,30 @@ public:
     int pageCount() const override;
     SizeF pageSizeInch() const override;
 
+    void setupDrawSystem(int deviceDpi, bool isPrinting) override;
+
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    PaintPagesFunc prepareViewPages(const RectF& frameRect, bool isPrinting) override;
+    void paintViewPages(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewInteraction(draw::Painter* painter, bool isPrinting) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
 
+    void invalidateDisplayLists();
+    void invalidateDisplayLists(const std::set<const mu::engraving::Page*>& pages);
+
 private:
+    //! NOTE What paintPageSheet paints, without the wallpaper
+    struct PageSheetStyle {
+        bool isFill = false;
+        draw::Color fillColor;
+        bool isBorder = false;
+        draw::Pen borderPen;
+        bool isContentBorder = false;
+        draw::Color contentBorderColor;
+    };
+
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
@@ -65,8 +88,19 @@ private:
     void paintPageBorder(draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                         bool printPageBackground) const;
+    PageSheetStyle pageSheetStyle(bool printPageBackground) const;
+    static void paintPageSheet(mu::draw::Painter* painter, const PageSheetStyle& style, const RectF& pageRect,
+                               const RectF& pageContentRect, bool isOdd);
+    void paintPageElements(mu::draw::Painter* painter, mu::engraving::Page* page, const RectF& rect, const Options& opt);
+    std::shared_ptr<const PageDisplayList> displayList(const mu::engraving::Page* page, bool isPrinting);
+    bool isPageSheetThreadSafe() const;
 
     Notation* m_notation = nullptr;
+
+    //! NOTE Shared with the snapshots of prepareViewPages, that can be painted after the lists are invalidated
+    std::map<const mu::engraving::Page*, std::shared_ptr<const PageDisplayList> > m_displayLists;
+    double m_displayListsPixelRatio = 0.0;
+    bool m_displayListsPrinting = false;
 };
 }
 
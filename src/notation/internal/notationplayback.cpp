@@ -74,6 +74,7 @@ void NotationPlayback::init(INotationUndoStackPtr undoStack)
 
     m_playbackModel.setPlayRepeats(configuration()->isPlayRepeatsEnabled());
     m_playbackModel.setPlayChordSymbols(configuration()->isPlayChordSymbolsEnabled());
+    m_playbackModel.setIncrementalLoad(true);
 
     m_playbackModel.load(score());
 
@@ -137,6 +138,11 @@ void NotationPlayback::triggerMetronome(int tick)
     m_playbackModel.triggerMetronome(tick);
 }
 
+void NotationPlayback::finishLoading()
+{
+    m_playbackModel.finishIncrementalLoad();
+}
+
 InstrumentTrackIdSet NotationPlayback::existingTrackIdSet() const
 {
     return m_playbackModel.existingTrackIdSet();
@@ -55,6 +55,8 @@ public:
     void triggerEventsForItems(const std::vector<const EngravingItem*>& items) override;
     void triggerMetronome(int tick) override;
 
+    void finishLoading() override;
+
     engraving::InstrumentTrackIdSet existingTrackIdSet() const override;
     async::Channel<engraving::InstrumentTrackId> trackAdded() const override;
     async::Channel<engraving::InstrumentTrackId> trackRemoved() const override;
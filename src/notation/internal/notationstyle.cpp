@@ -84,6 +84,7 @@ void NotationStyle::applyToAllParts()
     mu::engraving::MStyle style = m_getScore->score()->style();
 
     for (mu::engraving::Excerpt* excerpt : score()->masterScore()->excerpts()) {
+        excerpt->load();
         excerpt->excerptScore()->undo(new mu::engraving::ChangeStyle(excerpt->excerptScore(), style));
         excerpt->excerptScore()->update();
     }
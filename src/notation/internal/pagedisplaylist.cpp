@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pagedisplaylist.h"
+
+#include <algorithm>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "engraving/infrastructure/paint.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/score.h"
+#include "engraving/libmscore/system.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::engraving;
+
+void PageDisplayList::build(Page* page)
+{
+    TRACEFUNC;
+
+    m_groups.clear();
+
+    std::vector<EngravingItem*> items = page->items(page->bbox());
+    std::sort(items.begin(), items.end(), elementLessThan);
+
+    //! NOTE Strokes may be wider than the bbox of the item
+    const double margin = page->score()->spatium();
+
+    //! NOTE The layers (items of the same z, selection and visibility) are kept in the paint order,
+    //! the items of a layer are grouped by system. So an item can be painted out of the order only
+    //! relative to the items of other systems with the same z, which elementLessThan orders just by track
+    std::vector<SystemItems> layer;
+    const EngravingItem* layerFirstItem = nullptr;
+
+    for (const EngravingItem* item : items) {
+        if (!item->isInteractionAvailable()) {
+            continue;
+        }
+
+        if (layerFirstItem && !isSameLayer(layerFirstItem, item)) {
+            addLayer(layer, margin);
+            layer.clear();
+        }
+
+        if (layer.empty()) {
+            layerFirstItem = item;
+        }
+
+        const EngravingItem* system = item->findAncestor(ElementType::SYSTEM);
+        auto it = std::find_if(layer.begin(), layer.end(), [system](const SystemItems& systemItems) {
+            return systemItems.first == system;
+        });
+
+        if (it == layer.end()) {
+            layer.push_back({ system, {} });
+            it = std::prev(layer.end());
+        }
+
+        it->second.push_back(item);
+    }
+
+    addLayer(layer, margin);
+}
+
+void PageDisplayList::addLayer(const std::vector<SystemItems>& layer, double margin)
+{
+    for (const SystemItems& systemItems : layer) {
+        Group group;
+
+        std::vector<const EngravingItem*> recorded;
+
+        for (const EngravingItem* item : systemItems.second) {
+            group.bbox.unite(item->pageBoundingRect());
+
+            if (!isLiveItem(item)) {
+                recorded.push_back(item);
+                continue;
+            }
+
+            group.runs.push_back({ record(recorded), item });
+            recorded.clear();
+        }
+
+        if (!recorded.empty()) {
+            group.runs.push_back({ record(recorded), nullptr });
+        }
+
+        group.bbox.adjust(-margin, -margin, margin, margin);
+        m_groups.push_back(std::move(group));
+    }
+}
+
+void PageDisplayList::paint(draw::Painter* painter, const RectF& rect, bool isTextWorkaroundAllowed) const
+{
+    TRACEFUNC;
+
+    for (const Group& group : m_groups) {
+        if (!group.bbox.intersects(rect)) {
+            continue;
+        }
+
+        for (const Run& run : group.runs) {
+            draw::DrawDataPaint::paint(painter, run.data, isTextWorkaroundAllowed);
+
+            if (run.liveItem) {
+                engraving::Paint::paintElement(*painter, run.liveItem);
+            }
+        }
+    }
+}
+
+bool PageDisplayList::hasLiveItems() const
+{
+    for (const Group& group : m_groups) {
+        for (const Run& run : group.runs) {
+            if (run.liveItem) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PageDisplayList::isSameLayer(const EngravingItem* item1, const EngravingItem* item2)
+{
+    return item1->z() == item2->z() && item1->selected() == item2->selected() && item1->visible() == item2->visible();
+}
+
+bool PageDisplayList::isLiveItem(const EngravingItem* item)
+{
+    return item->isImage();
+}
+
+draw::DrawData PageDisplayList::record(const std::vector<const EngravingItem*>& items)
+{
+    auto provider = std::make_shared<draw::BufferedPaintProvider>();
+
+    {
+        draw::Painter painter(provider, "pagedisplaylist");
+        painter.setAntialiasing(true);
+
+        for (const EngravingItem* item : items) {
+            engraving::Paint::paintElement(painter, item);
+        }
+
+        painter.endDraw();
+    }
+
+    return provider->drawData();
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_PAGEDISPLAYLIST_H
+#define MU_NOTATION_PAGEDISPLAYLIST_H
+
+#include <utility>
+#include <vector>
+
+#include "draw/painter.h"
+#include "draw/buffereddrawtypes.h"
+
+namespace mu::engraving {
+class Page;
+class EngravingItem;
+}
+
+namespace mu::notation {
+//! NOTE The draw commands of the elements of a page, recorded once and replayed on repaints of the view,
+//! so that scrolling and zooming do not call draw() of every element.
+//! The elements are recorded in the paint order (elementLessThan) in groups of one system and one z-layer,
+//! a repaint replays only the groups that intersect the painted rect.
+//! The list should be rebuilt after every change of the layout, selection or anything else that changes the drawing
+class PageDisplayList
+{
+public:
+    void build(mu::engraving::Page* page);
+    void paint(draw::Painter* painter, const RectF& rect, bool isTextWorkaroundAllowed) const;
+
+    //! NOTE Without the live items painting doesn't access the elements, so the list can be painted from any thread
+    bool hasLiveItems() const;
+
+private:
+    struct Run {
+        draw::DrawData data;
+        //! NOTE Drawn directly after the data: images are drawn for the current zoom of the painter
+        const mu::engraving::EngravingItem* liveItem = nullptr;
+    };
+
+    struct Group {
+        RectF bbox; // page coordinates
+        std::vector<Run> runs;
+    };
+
+    using SystemItems = std::pair<const mu::engraving::EngravingItem*, std::vector<const mu::engraving::EngravingItem*> >;
+
+    void addLayer(const std::vector<SystemItems>& layer, double margin);
+
+    static bool isSameLayer(const mu::engraving::EngravingItem* item1, const mu::engraving::EngravingItem* item2);
+    static bool isLiveItem(const mu::engraving::EngravingItem* item);
+    static draw::DrawData record(const std::vector<const mu::engraving::EngravingItem*>& items);
+
+    std::vector<Group> m_groups;
+};
+}
+
+#endif // MU_NOTATION_PAGEDISPLAYLIST_H
@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "scorerefreshlistener.h"
+
+#include "libmscore/score.h"
+
+using namespace mu;
+using namespace mu::notation;
+
+ScoreRefreshListener::~ScoreRefreshListener()
+{
+    setScore(nullptr);
+}
+
+void ScoreRefreshListener::setScore(mu::engraving::Score* score)
+{
+    if (m_score == score) {
+        return;
+    }
+
+    if (m_score) {
+        m_score->removeViewer(this);
+    }
+
+    m_score = score;
+
+    if (m_score) {
+        m_score->addViewer(this);
+    }
+}
+
+void ScoreRefreshListener::removeScore()
+{
+    //! NOTE Called from ~Score, the score removes its viewers itself
+    m_score = nullptr;
+}
+
+void ScoreRefreshListener::dataChanged(const RectF& rect)
+{
+    if (rect.isValid()) {
+        m_areaChanged.send(rect);
+    }
+}
+
+void ScoreRefreshListener::layoutRangeChanged(const RectF& rect)
+{
+    m_areaChanged.send(rect);
+}
+
+void ScoreRefreshListener::updateAll()
+{
+    m_areaChanged.send(RectF());
+}
+
+void ScoreRefreshListener::drawBackground(draw::Painter*, const RectF&) const
+{
+}
+
+const Rect ScoreRefreshListener::geometry() const
+{
+    return Rect();
+}
+
+async::Channel<RectF> ScoreRefreshListener::areaChanged() const
+{
+    return m_areaChanged;
+}
@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_SCOREREFRESHLISTENER_H
+#define MU_NOTATION_SCOREREFRESHLISTENER_H
+
+#include "libmscore/mscoreview.h"
+
+#include "async/channel.h"
+
+namespace mu::notation {
+//! NOTE Receives the areas of the score to redraw from Score::update(),
+//! dataChanged() gives the area of the last changes, updateAll() is sent as an empty rect
+class ScoreRefreshListener : public mu::engraving::MuseScoreView
+{
+public:
+    ScoreRefreshListener() = default;
+    ~ScoreRefreshListener() override;
+
+    void setScore(mu::engraving::Score* score) override;
+    void removeScore() override;
+
+    void dataChanged(const RectF& rect) override;
+    void layoutRangeChanged(const RectF& rect) override;
+    void updateAll() override;
+    void drawBackground(draw::Painter*, const RectF&) const override;
+    const Rect geometry() const override;
+
+    async::Channel<RectF> areaChanged() const;
+
+private:
+    async::Channel<RectF> m_areaChanged;
+};
+}
+
+#endif // MU_NOTATION_SCOREREFRESHLISTENER_H
@@ -0,0 +1,238 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QImage>
+#include <QPainter>
+
+#include "notation/view/notationtilecache.h"
+
+#include "async/processevents.h"
+#include "runtime.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::draw;
+
+class Notation_NotationTileCacheTests : public ::testing::Test
+{
+public:
+    static constexpr double TILE = NotationTileCache::TILE_SIZE;
+
+    //! NOTE The size of one tile image with the device pixel ratio 1
+    static constexpr size_t TILE_BYTES = NotationTileCache::TILE_SIZE * NotationTileCache::TILE_SIZE * 4;
+
+    //! NOTE Paints the view rect through the cache, returns the canvas rects of the tiles painted from the "score" in the main thread.
+    //! If backgroundPaint is set, the missing tiles are painted by it in the background
+    std::vector<RectF> paint(NotationTileCache& cache, const RectF& viewRect, const Transform& transform = Transform(),
+                             const NotationTileCache::PaintTileFunc& backgroundPaint = nullptr)
+    {
+        std::vector<RectF> paintedTiles;
+
+        QImage target(static_cast<int>(viewRect.right()), static_cast<int>(viewRect.bottom()), QImage::Format_ARGB32_Premultiplied);
+        QPainter painter(&target);
+
+        auto prepare = [backgroundPaint](const RectF&) {
+            return backgroundPaint;
+        };
+
+        auto paintTile = [&paintedTiles](Painter*, const RectF& rect) {
+            paintedTiles.push_back(rect);
+        };
+
+        auto update = [this]() {
+            ++m_updateCount;
+        };
+
+        cache.paint(&painter, viewRect, transform, 1.0, prepare, paintTile, update);
+
+        return paintedTiles;
+    }
+
+    //! NOTE Delivers the tiles painted in the background, like the event loop of the main thread
+    void processEvents(int updateCount, std::chrono::milliseconds timeout = std::chrono::seconds(10))
+    {
+        auto end = std::chrono::steady_clock::now() + timeout;
+        while (m_updateCount < updateCount && std::chrono::steady_clock::now() < end) {
+            async::processEvents();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    int m_updateCount = 0;
+};
+
+TEST_F(Notation_NotationTileCacheTests, Lookup)
+{
+    //! GIVEN The cache with the tiles of a view of 2x2 tiles
+    NotationTileCache cache;
+    RectF viewRect(0, 0, 2 * TILE, 2 * TILE);
+
+    //! DO Paint the view the first time
+    std::vector<RectF> painted = paint(cache, viewRect);
+
+    //! CHECK All the tiles are painted
+    EXPECT_EQ(painted.size(), 4);
+
+    //! DO Paint the same view again
+    painted = paint(cache, viewRect);
+
+    //! CHECK The tiles are taken from the cache
+    EXPECT_TRUE(painted.empty());
+
+    //! DO Paint the view with another scaling
+    painted = paint(cache, viewRect, Transform(2.0, 0.0, 0.0, 2.0, 0.0, 0.0));
+
+    //! CHECK The tiles of the other scaling are painted, each covers half the canvas size
+    ASSERT_EQ(painted.size(), 4);
+    EXPECT_EQ(painted.front(), RectF(0, 0, TILE / 2, TILE / 2));
+}
+
+TEST_F(Notation_NotationTileCacheTests, LruEviction)
+{
+    //! GIVEN The cache can keep only two tiles
+    NotationTileCache cache(2 * TILE_BYTES);
+
+    RectF tileA(0, 0, TILE, TILE);
+    RectF tileB(TILE, 0, TILE, TILE);
+    RectF tileC(2 * TILE, 0, TILE, TILE);
+
+    //! DO Paint the tiles A, B, use A again, then paint C
+    paint(cache, tileA);
+    paint(cache, tileB);
+    EXPECT_TRUE(paint(cache, tileA).empty());
+    EXPECT_EQ(paint(cache, tileC).size(), 1);
+
+    //! CHECK The least recently used tile B is evicted, A and C are still cached
+    EXPECT_TRUE(paint(cache, tileA).empty());
+    EXPECT_TRUE(paint(cache, tileC).empty());
+    EXPECT_EQ(paint(cache, tileB).size(), 1);
+}
+
+TEST_F(Notation_NotationTileCacheTests, VisibleTilesAreNotEvicted)
+{
+    //! GIVEN The cache can keep only one tile
+    NotationTileCache cache(TILE_BYTES);
+    RectF viewRect(0, 0, 3 * TILE, TILE);
+
+    //! DO Paint a view of three tiles
+    EXPECT_EQ(paint(cache, viewRect).size(), 3);
+
+    //! CHECK The visible tiles are kept, even over the limit
+    EXPECT_TRUE(paint(cache, viewRect).empty());
+}
+
+TEST_F(Notation_NotationTileCacheTests, Invalidate)
+{
+    //! GIVEN The cache with the tiles of a view of 3x3 tiles
+    NotationTileCache cache;
+    RectF viewRect(0, 0, 3 * TILE, 3 * TILE);
+    paint(cache, viewRect);
+
+    //! DO Invalidate a rect inside the middle tile
+    cache.invalidate(RectF(TILE + 10, TILE + 10, 20, 20));
+
+    //! CHECK Only the middle tile is painted again
+    std::vector<RectF> painted = paint(cache, viewRect);
+    ASSERT_EQ(painted.size(), 1);
+    EXPECT_EQ(painted.front(), RectF(TILE, TILE, TILE, TILE));
+
+    //! DO Invalidate a rect over the border of the two tiles of the first row
+    cache.invalidate(RectF(TILE - 10, 10, 20, 20));
+
+    //! CHECK Both tiles are painted again
+    painted = paint(cache, viewRect);
+    ASSERT_EQ(painted.size(), 2);
+    EXPECT_EQ(painted.at(0), RectF(0, 0, TILE, TILE));
+    EXPECT_EQ(painted.at(1), RectF(TILE, 0, TILE, TILE));
+
+    //! DO Clear the cache
+    cache.clear();
+
+    //! CHECK All the tiles are painted again
+    EXPECT_EQ(paint(cache, viewRect).size(), 9);
+}
+
+TEST_F(Notation_NotationTileCacheTests, BackgroundPaint)
+{
+    //! GIVEN The tiles of a view of 2x1 tiles can be painted in the background
+    runtime::mainThreadId();
+
+    NotationTileCache cache;
+    RectF viewRect(0, 0, 2 * TILE, TILE);
+
+    std::mutex mutex;
+    std::vector<RectF> backgroundTiles;
+    auto backgroundPaint = [&mutex, &backgroundTiles](Painter*, const RectF& rect) {
+        std::lock_guard lock(mutex);
+        backgroundTiles.push_back(rect);
+    };
+
+    auto backgroundTileCount = [&mutex, &backgroundTiles]() {
+        std::lock_guard lock(mutex);
+        return backgroundTiles.size();
+    };
+
+    //! DO Paint the view the first time
+    std::vector<RectF> painted = paint(cache, viewRect, Transform(), backgroundPaint);
+
+    //! CHECK Nothing is painted in the main thread
+    EXPECT_TRUE(painted.empty());
+
+    //! DO Wait for the tiles
+    processEvents(2);
+
+    //! CHECK Both tiles are painted in the background, the view is updated for each
+    EXPECT_EQ(m_updateCount, 2);
+    EXPECT_EQ(backgroundTileCount(), 2);
+
+    //! CHECK The painted tiles are taken from the cache
+    EXPECT_TRUE(paint(cache, viewRect, Transform(), backgroundPaint).empty());
+    EXPECT_EQ(backgroundTileCount(), 2);
+
+    //! DO Invalidate the first tile, paint the view and invalidate the tile again while it is painted
+    cache.invalidate(RectF(10, 10, 20, 20));
+    paint(cache, viewRect, Transform(), backgroundPaint);
+    cache.invalidate(RectF(10, 10, 20, 20));
+
+    while (backgroundTileCount() < 3) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    processEvents(3, std::chrono::milliseconds(100));
+
+    //! CHECK The outdated tile is not taken
+    EXPECT_EQ(m_updateCount, 2);
+
+    //! DO Paint the view again
+    paint(cache, viewRect, Transform(), backgroundPaint);
+    processEvents(3);
+
+    //! CHECK Only the invalidated tile is painted again
+    EXPECT_EQ(m_updateCount, 3);
+    EXPECT_EQ(backgroundTileCount(), 4);
+}
@@ -116,6 +116,7 @@ void AbstractNotationPaintView::initBackground()
 void AbstractNotationPaintView::initNavigatorOrientation()
 {
     configuration()->canvasOrientation().ch.onReceive(this, [this](framework::Orientation) {
+        clearTiles();
         moveCanvasToPosition(PointF(0, 0));
     });
 }
@@ -232,6 +233,24 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
+
+        //! NOTE Score edits have already reported the area they changed,
+        //! other changes (view mode, selection color, ...) repaint everything
+        if (!m_tilesAreaInvalidated) {
+            clearTiles();
+        }
+
+        update();
+    });
+
+    m_notation->notationAreaChanged().onReceive(this, [this](const RectF& rect) {
+        if (rect.isValid()) {
+            invalidateTiles(rect);
+        } else {
+            clearTiles();
+        }
+
+        m_tilesAreaInvalidated = true;
         update();
     });
 
@@ -241,6 +260,11 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->selectionChanged().onNotify(this, [this]() {
+        //! NOTE The colors of the previously and the newly selected elements are changed
+        RectF rect = selectionRect();
+        invalidateTiles(m_tilesSelectionRect.united(rect));
+        m_tilesSelectionRect = rect;
+
         update();
     });
 
@@ -288,6 +312,8 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         });
     }
 
+    clearTiles();
+
     forceFocusIn();
     update();
 
@@ -299,6 +325,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
 {
     m_notation->notationChanged().resetOnNotify(this);
+    m_notation->notationAreaChanged().resetOnReceive(this);
     INotationInteractionPtr interaction = m_notation->interaction();
     interaction->noteInput()->stateChanged().resetOnNotify(this);
     interaction->selectionChanged().resetOnNotify(this);
@@ -508,10 +535,19 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
-
+    Transform transform = m_matrix * guiScalingCompensation;
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    if (NotationTileCache::isSupported(transform)) {
+        transform = NotationTileCache::alignedTransform(transform, qp->device()->devicePixelRatioF());
+        paintTiles(qp, rect, transform, isPrinting);
+
+        painter->setWorldTransform(transform);
+        notation()->painting()->paintViewInteraction(painter, isPrinting);
+    } else {
+        painter->setWorldTransform(transform);
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -528,6 +564,63 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     }
 }
 
+void AbstractNotationPaintView::paintTiles(QPainter* painter, const RectF& rect, const Transform& transform, bool isPrinting)
+{
+    TRACEFUNC;
+
+    if (m_tilesPrinting != isPrinting) {
+        clearTiles();
+        m_tilesPrinting = isPrinting;
+    }
+
+    m_tilesAreaInvalidated = false;
+
+    INotationPaintingPtr painting = notation()->painting();
+    painting->setupDrawSystem(uiConfiguration()->logicalDpi(), isPrinting);
+
+    auto prepare = [painting, isPrinting](const RectF& tilesRect) {
+        return painting->prepareViewPages(tilesRect, isPrinting);
+    };
+
+    auto paintTile = [painting, isPrinting](Painter* tilePainter, const RectF& tileRect) {
+        painting->paintViewPages(tilePainter, tileRect, isPrinting);
+    };
+
+    auto updateView = [this]() {
+        update();
+    };
+
+    m_tileCache.paint(painter, rect, transform, painter->device()->devicePixelRatioF(), prepare, paintTile, updateView);
+}
+
+RectF AbstractNotationPaintView::selectionRect() const
+{
+    INotationSelectionPtr selection = notationSelection();
+    if (!selection || selection->isNone()) {
+        return RectF();
+    }
+
+    //! NOTE Like in Score::update(), strokes may be wider than the bbox of the item
+    RectF rect;
+    for (const EngravingItem* item : selection->elements()) {
+        double margin = item->spatium() * 0.5;
+        rect.unite(item->canvasBoundingRect().adjusted(-margin, -margin, margin, margin));
+    }
+
+    return rect;
+}
+
+void AbstractNotationPaintView::invalidateTiles(const RectF& rect)
+{
+    m_tileCache.invalidate(rect);
+}
+
+void AbstractNotationPaintView::clearTiles()
+{
+    m_tileCache.clear();
+    m_tilesSelectionRect = selectionRect();
+}
+
 void AbstractNotationPaintView::onNotationSetup()
 {
     TRACEFUNC;
@@ -547,14 +640,22 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        clearTiles();
         update();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        clearTiles();
         update();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        clearTiles();
+        update();
+    });
+
+    engravingConfiguration()->scoreInversionChanged().onNotify(this, [this]() {
+        clearTiles();
         update();
     });
 }
@@ -45,6 +45,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 
 namespace mu::notation {
 class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public IControlledView, public async::Asyncable,
@@ -230,6 +231,11 @@ private:
     PointF alignToCurrentPageBorder(const RectF& showRect, const PointF& pos) const;
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
+    void paintTiles(QPainter* painter, const RectF& rect, const draw::Transform& transform, bool isPrinting);
+
+    RectF selectionRect() const;
+    void invalidateTiles(const RectF& rect);
+    void clearTiles();
 
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
@@ -244,6 +250,11 @@ private:
     std::unique_ptr<LoopMarker> m_loopOutMarker;
     std::unique_ptr<ContinuousPanel> m_continuousPanel;
 
+    NotationTileCache m_tileCache;
+    bool m_tilesPrinting = false;
+    RectF m_tilesSelectionRect;
+    bool m_tilesAreaInvalidated = false;
+
     qreal m_previousVerticalScrollPosition = 0;
     qreal m_previousHorizontalScrollPosition = 0;
 
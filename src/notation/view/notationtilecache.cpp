@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include <QPainter>
+
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+#include "realfn.h"
+#include "runtime.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::draw;
+
+static int64_t toMicroUnits(double value)
+{
+    return static_cast<int64_t>(std::llround(value * 1000000.0));
+}
+
+NotationTileCache::NotationTileCache(size_t maxBytes)
+    : m_maxBytes(maxBytes), m_self(std::make_shared<NotationTileCache*>(this))
+{
+}
+
+bool NotationTileCache::Key::operator<(const Key& other) const
+{
+    return std::tie(scaling, devicePixelRatio, i, j) < std::tie(other.scaling, other.devicePixelRatio, other.i, other.j);
+}
+
+bool NotationTileCache::isSupported(const Transform& transform)
+{
+    return RealIsNull(transform.m12()) && RealIsNull(transform.m21())
+           && RealIsEqual(transform.m11(), transform.m22()) && transform.m11() > 0.0;
+}
+
+Transform NotationTileCache::alignedTransform(const Transform& transform, double devicePixelRatio)
+{
+    double dx = std::round(transform.dx() * devicePixelRatio) / devicePixelRatio;
+    double dy = std::round(transform.dy() * devicePixelRatio) / devicePixelRatio;
+    return Transform(transform.m11(), 0.0, 0.0, transform.m22(), dx, dy);
+}
+
+NotationTileCache::Key NotationTileCache::makeKey(double scaling, double devicePixelRatio, int i, int j)
+{
+    Key key;
+    key.scaling = toMicroUnits(scaling);
+    key.devicePixelRatio = toMicroUnits(devicePixelRatio);
+    key.i = i;
+    key.j = j;
+    return key;
+}
+
+void NotationTileCache::paint(QPainter* painter, const RectF& viewRect, const Transform& transform, double devicePixelRatio,
+                              const PrepareFunc& prepare, const PaintTileFunc& paintTile, const UpdateFunc& update)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(isSupported(transform)) {
+        return;
+    }
+
+    m_update = update;
+
+    const double scaling = transform.m11();
+    const double tileSize = TILE_SIZE;
+    const double tileCanvasSize = tileSize / scaling;
+
+    const int fromI = static_cast<int>(std::floor((viewRect.left() - transform.dx()) / tileSize));
+    const int toI = static_cast<int>(std::ceil((viewRect.right() - transform.dx()) / tileSize));
+    const int fromJ = static_cast<int>(std::floor((viewRect.top() - transform.dy()) / tileSize));
+    const int toJ = static_cast<int>(std::ceil((viewRect.bottom() - transform.dy()) / tileSize));
+
+    std::vector<Tile*> visibleTiles;
+    std::vector<Tile*> missingTiles;
+    RectF missingRect;
+
+    for (int j = fromJ; j < toJ; ++j) {
+        for (int i = fromI; i < toI; ++i) {
+            Key key = makeKey(scaling, devicePixelRatio, i, j);
+
+            auto it = m_tilesByKey.find(key);
+            if (it != m_tilesByKey.end()) {
+                m_tiles.splice(m_tiles.begin(), m_tiles, it->second);
+            } else {
+                Tile tile;
+                tile.key = key;
+                tile.rect = RectF(i * tileCanvasSize, j * tileCanvasSize, tileCanvasSize, tileCanvasSize);
+                m_tiles.push_front(std::move(tile));
+                m_tilesByKey[key] = m_tiles.begin();
+            }
+
+            Tile* tile = &m_tiles.front();
+            visibleTiles.push_back(tile);
+
+            if (!tile->isValid && tile->paintId == 0) {
+                missingTiles.push_back(tile);
+                missingRect.unite(tile->rect);
+            }
+        }
+    }
+
+    if (!missingTiles.empty()) {
+        PaintTileFunc backgroundPaint = prepare(missingRect);
+
+        for (Tile* tile : missingTiles) {
+            if (backgroundPaint) {
+                paintInBackground(*tile, scaling, devicePixelRatio, backgroundPaint);
+            } else {
+                setImage(*tile, renderTile(tile->key, tile->rect, scaling, devicePixelRatio, paintTile));
+                tile->isValid = true;
+            }
+        }
+    }
+
+    painter->save();
+    painter->resetTransform();
+
+    for (const Tile* tile : visibleTiles) {
+        if (tile->image.isNull()) {
+            continue;
+        }
+
+        QPointF pos(tile->key.i * tileSize + transform.dx(), tile->key.j * tileSize + transform.dy());
+        painter->drawImage(pos, tile->image);
+    }
+
+    painter->restore();
+
+    shrink(visibleTiles.size());
+}
+
+QImage NotationTileCache::renderTile(const Key& key, const RectF& rect, double scaling, double devicePixelRatio,
+                                     const PaintTileFunc& paint)
+{
+    const int size = static_cast<int>(std::ceil(TILE_SIZE * devicePixelRatio));
+
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+
+    QPainter qp(&image);
+    Painter painter(&qp, "notationtile");
+    painter.setWorldTransform(Transform(scaling, 0.0, 0.0, scaling, -key.i * double(TILE_SIZE), -key.j * double(TILE_SIZE)));
+
+    paint(&painter, rect);
+
+    return image;
+}
+
+void NotationTileCache::paintInBackground(Tile& tile, double scaling, double devicePixelRatio, const PaintTileFunc& paint)
+{
+    tile.paintId = ++m_lastPaintId;
+
+    std::weak_ptr<NotationTileCache*> weakSelf = m_self;
+    Key key = tile.key;
+    RectF rect = tile.rect;
+    uint64_t paintId = tile.paintId;
+
+    TaskScheduler::instance()->pushWithPriority(TaskPriority::Normal, [weakSelf, key, rect, paintId, scaling, devicePixelRatio, paint]() {
+        QImage image = renderTile(key, rect, scaling, devicePixelRatio, paint);
+
+        async::Async::call(nullptr, [weakSelf, key, paintId, image]() {
+            std::shared_ptr<NotationTileCache*> self = weakSelf.lock();
+            if (self) {
+                (*self)->onTilePainted(key, paintId, image);
+            }
+        }, runtime::mainThreadId());
+    });
+}
+
+void NotationTileCache::onTilePainted(const Key& key, uint64_t paintId, const QImage& image)
+{
+    //! NOTE The tile could be removed or invalidated again while it was painted
+    auto it = m_tilesByKey.find(key);
+    if (it == m_tilesByKey.end() || it->second->paintId != paintId) {
+        return;
+    }
+
+    Tile& tile = *it->second;
+    setImage(tile, image);
+    tile.isValid = true;
+    tile.paintId = 0;
+
+    if (m_update) {
+        m_update();
+    }
+}
+
+void NotationTileCache::setImage(Tile& tile, const QImage& image)
+{
+    m_bytes -= static_cast<size_t>(tile.image.sizeInBytes());
+    tile.image = image;
+    m_bytes += static_cast<size_t>(tile.image.sizeInBytes());
+}
+
+void NotationTileCache::invalidate(const RectF& rect)
+{
+    for (Tile& tile : m_tiles) {
+        if (tile.rect.intersects(rect)) {
+            tile.isValid = false;
+            tile.paintId = 0;
+        }
+    }
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+    m_tilesByKey.clear();
+    m_bytes = 0;
+}
+
+void NotationTileCache::erase(TileList::iterator it)
+{
+    m_bytes -= static_cast<size_t>(it->image.sizeInBytes());
+    m_tilesByKey.erase(it->key);
+    m_tiles.erase(it);
+}
+
+void NotationTileCache::shrink(size_t keepCount)
+{
+    while (m_bytes > m_maxBytes && m_tiles.size() > keepCount) {
+        erase(std::prev(m_tiles.end()));
+    }
+}
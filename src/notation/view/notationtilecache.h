@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+
+#include <QImage>
+
+#include "draw/painter.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Rasterized tiles of the notation: the view is repainted by drawing the cached images,
+//! only the tiles that are not cached yet (new area, other zoom or invalidated) are painted from the score.
+//! If the notation can be painted without the score (see PrepareFunc), the missing tiles are painted
+//! in the background and the view is updated when they are ready, meanwhile an invalidated tile shows its previous image.
+//! A tile is a square of TILE_SIZE view pixels, the tiles of one scaling are a grid starting at the canvas origin.
+//! The last used tiles of all scalings are kept, up to MAX_CACHE_BYTES
+class NotationTileCache
+{
+public:
+    static constexpr int TILE_SIZE = 256;
+    static constexpr size_t MAX_CACHE_BYTES = 128 * 1024 * 1024;
+
+    //! NOTE The painter is transformed to the canvas coordinates, rect is the area of the tile in the canvas coordinates
+    using PaintTileFunc = std::function<void (draw::Painter* painter, const RectF& rect)>;
+
+    //! NOTE Called before painting the missing tiles, rect is their area in the canvas coordinates.
+    //! Returns a function that paints the tiles from any thread, or nullptr if they must be painted in the main thread
+    using PrepareFunc = std::function<PaintTileFunc (const RectF& rect)>;
+
+    //! NOTE Called in the main thread when a tile painted in the background is ready
+    using UpdateFunc = std::function<void ()>;
+
+    explicit NotationTileCache(size_t maxBytes = MAX_CACHE_BYTES);
+
+    //! NOTE Returns false if the transform is not supported (not a scale and translation)
+    static bool isSupported(const draw::Transform& transform);
+
+    //! NOTE Moves the transform to the pixel grid of the device, so that the tiles are not blurred,
+    //! the view should paint everything else with the same transform
+    static draw::Transform alignedTransform(const draw::Transform& transform, double devicePixelRatio);
+
+    //! NOTE Draws the tiles of the view rect (view coordinates), the missing tiles are painted
+    //! in the background by the function returned by prepare, or else by paintTile
+    void paint(QPainter* painter, const RectF& viewRect, const draw::Transform& transform, double devicePixelRatio,
+               const PrepareFunc& prepare, const PaintTileFunc& paintTile, const UpdateFunc& update);
+
+    //! NOTE rect in the canvas coordinates
+    void invalidate(const RectF& rect);
+    void clear();
+
+private:
+    struct Key {
+        int64_t scaling = 0; // micro units
+        int64_t devicePixelRatio = 0; // micro units
+        int i = 0;
+        int j = 0;
+
+        bool operator<(const Key& other) const;
+    };
+
+    struct Tile {
+        Key key;
+        RectF rect; // canvas coordinates
+        QImage image; // may be the previous image, if the tile is invalidated
+        bool isValid = false;
+        uint64_t paintId = 0; // of the background paint in progress, 0 if none
+    };
+
+    using TileList = std::list<Tile>;
+
+    static Key makeKey(double scaling, double devicePixelRatio, int i, int j);
+    static QImage renderTile(const Key& key, const RectF& rect, double scaling, double devicePixelRatio, const PaintTileFunc& paint);
+
+    void paintInBackground(Tile& tile, double scaling, double devicePixelRatio, const PaintTileFunc& paint);
+    void onTilePainted(const Key& key, uint64_t paintId, const QImage& image);
+    void setImage(Tile& tile, const QImage& image);
+
+    void erase(TileList::iterator it);
+    void shrink(size_t keepCount);
+
+    TileList m_tiles; // the most recently used first
+    std::map<Key, TileList::iterator> m_tilesByKey;
+    size_t m_bytes = 0;
+    size_t m_maxBytes = 0;
+
+    uint64_t m_lastPaintId = 0;
+    UpdateFunc m_update;
+
+    //! NOTE The background paints report to the cache only while it exists
+    std::shared_ptr<NotationTileCache*> m_self;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
@@ -329,6 +329,7 @@ void PageSettings::applyToAllParts()
         return;
     }
     for (Excerpt* e : score()->masterScore()->excerpts()) {
+        e->load();
         applyToScore(e->excerptScore());
     }
     _changeFlag = false;
@@ -32,6 +32,7 @@ namespace PluginAPI {
 
 Score* Excerpt::partScore()
 {
+    e->load();
     return wrap<Score>(e->excerptScore(), Ownership::SCORE);
 }
 
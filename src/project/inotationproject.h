@@ -26,6 +26,7 @@
 
 #include "io/path.h"
 #include "types/ret.h"
+#include "types/retval.h"
 
 #include "projecttypes.h"
 #include "notation/imasternotation.h"
@@ -64,6 +65,9 @@ public:
     virtual Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) = 0;
     virtual Ret writeToDevice(QIODevice* device) = 0;
 
+    //! NOTE Writes the project to memory on the calling thread, the returned job stores it to the path
+    virtual RetVal<SaveJob> prepareAutoSave(const io::path_t& path) = 0;
+
     virtual ProjectMeta metaInfo() const = 0;
     virtual void setMetaInfo(const ProjectMeta& meta, bool undoable = false) = 0;
 
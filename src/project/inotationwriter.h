@@ -47,7 +47,8 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        BEATS_COLORS
+        BEATS_COLORS,
+        DRAW_SYSTEM_READY
     };
 
     using Options = QMap<OptionKey, Val>;
@@ -58,6 +59,13 @@ public:
     virtual Ret write(notation::INotationPtr notation, QIODevice& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, QIODevice& device, const Options& options = Options()) = 0;
 
+    //! NOTE Some PER_PAGE writers can write the pages of one notation from several threads at once.
+    //! beginParallelPageWrite sets up the state shared by the pages on the calling thread and adds DRAW_SYSTEM_READY
+    //! to the options, then write() with these options can be called for every page, until endParallelPageWrite
+    virtual bool supportsParallelPageWrite() const { return false; }
+    virtual void beginParallelPageWrite(notation::INotationPtr /*notation*/, Options& /*options*/) {}
+    virtual void endParallelPageWrite(notation::INotationPtr /*notation*/, const Options& /*options*/) {}
+
     virtual bool supportsProgressNotifications() const { return false; }
     virtual framework::Progress progress() const { return framework::Progress(); }
 
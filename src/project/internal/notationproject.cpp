@@ -456,20 +456,41 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
         return ret;
     }
     case SaveMode::AutoSave:
-        std::string suffix = io::suffix(path);
-        if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
-            suffix = io::suffix(io::completeBasename(path));
+        RetVal<SaveJob> job = prepareAutoSave(path);
+        if (!job.ret) {
+            return job.ret;
         }
 
-        if (suffix.empty()) {
-            // Then it must be a MSCX folder
-            suffix = engraving::MSCX;
+        return job.val();
+    }
+
+    return make_ret(notation::Err::UnknownError);
+}
+
+mu::RetVal<SaveJob> NotationProject::prepareAutoSave(const io::path_t& path)
+{
+    TRACEFUNC;
+
+    std::string suffix = io::suffix(path);
+    if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
+        suffix = io::suffix(io::completeBasename(path));
+    }
+
+    if (suffix.empty()) {
+        // Then it must be a MSCX folder
+        suffix = engraving::MSCX;
+    }
+
+    if (!isMuseScoreFile(suffix)) {
+        Ret ret = exportProject(path, suffix);
+        if (!ret) {
+            return ret;
         }
 
-        return saveScore(path, suffix);
+        return RetVal<SaveJob>::make_ok([]() { return make_ret(Ret::Code::Ok); });
     }
 
-    return make_ret(notation::Err::UnknownError);
+    return prepareSave(path, mscIoModeBySuffix(suffix), true /*isAutoSave*/);
 }
 
 mu::Ret NotationProject::writeToDevice(QIODevice* device)
@@ -485,6 +506,9 @@ mu::Ret NotationProject::writeToDevice(QIODevice* device)
     params.device = &buf;
     params.filePath = m_path.toQString();
     params.mode = MscIoMode::Zip;
+    if (io::suffix(m_path) == engraving::MSCZ) {
+        params.sourceFilePath = m_path;
+    }
 
     MscWriter msczWriter(params);
     msczWriter.open();
@@ -513,6 +537,20 @@ mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fi
 }
 
 mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode)
+{
+    RetVal<SaveJob> job = prepareSave(path, ioMode, false /*isAutoSave*/);
+    if (!job.ret) {
+        return job.ret;
+    }
+
+    if (generateBackup) {
+        makeCurrentFileAsBackup();
+    }
+
+    return job.val();
+}
+
+mu::RetVal<SaveJob> NotationProject::prepareSave(const io::path_t& path, engraving::MscIoMode ioMode, bool isAutoSave)
 {
     QString targetContainerPath = engraving::containerPath(path).toQString();
     io::path_t targetMainFilePath = engraving::mainFilePath(path);
@@ -536,74 +574,93 @@ mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, eng
         }
     }
 
-    // Step 2: write project
+    // Step 2: write project to memory
+    //! NOTE The writer is deferred: here the project is only serialized,
+    //! the files are compressed and written by the job
+    auto msczWriter = std::make_shared<MscWriter>();
     {
         MscWriter::Params params;
         params.filePath = savePath;
         params.mainFileName = targetMainFileName.toQString();
         params.mode = ioMode;
+        params.deferred = true;
         IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
             return make_ret(Ret::Code::InternalError);
         }
 
-        MscWriter msczWriter(params);
-        Ret ret = writeProject(msczWriter, false);
+        //! NOTE The autosave job runs in the background, while a manual save may replace the file at m_path,
+        //! so the autosave doesn't copy the unchanged files from there
+        if (!isAutoSave && ioMode == MscIoMode::Zip && io::suffix(m_path) == engraving::MSCZ) {
+            params.sourceFilePath = m_path;
+        }
+
+        msczWriter->setParams(params);
+
+        //! NOTE The thumbnail isn't needed to restore the project, so it isn't created for the autosave
+        Ret ret = writeProject(*msczWriter, false, !isAutoSave /*createThumbnail*/);
         if (!ret) {
             LOGE() << "failed write project to buffer";
             return ret;
         }
-
-        msczWriter.close();
     }
 
-    // Step 3: create backup if need
-    {
-        if (generateBackup) {
-            makeCurrentFileAsBackup();
-        }
-    }
+    auto fileSystem = this->fileSystem();
 
-    // Step 4: replace to saved file
-    {
-        if (ioMode == MscIoMode::Dir) {
-            RetVal<io::paths_t> filesToBeMoved = fileSystem()->scanFiles(savePath, { "*" }, io::ScanMode::FilesAndFoldersInCurrentDir);
-            if (!filesToBeMoved.ret) {
-                return filesToBeMoved.ret;
+    SaveJob job = [msczWriter, fileSystem, ioMode, savePath, targetContainerPath, targetMainFilePath]() -> Ret {
+        TRACEFUNC;
+
+        // Step 3: compress and write project
+        {
+            if (!msczWriter->writeDeferred()) {
+                LOGE() << "failed write project: " << savePath;
+                return make_ret(engraving::Err::FileOpenError);
             }
+        }
+
+        // Step 4: replace to saved file
+        {
+            if (ioMode == MscIoMode::Dir) {
+                RetVal<io::paths_t> filesToBeMoved = fileSystem->scanFiles(savePath, { "*" }, io::ScanMode::FilesAndFoldersInCurrentDir);
+                if (!filesToBeMoved.ret) {
+                    return filesToBeMoved.ret;
+                }
+
+                Ret ret = make_ok();
 
-            Ret ret = make_ok();
+                for (const io::path_t& fileToBeMoved : filesToBeMoved.val) {
+                    io::path_t destinationFile
+                        = io::path_t(targetContainerPath).appendingComponent(io::filename(fileToBeMoved));
+                    LOGD() << fileToBeMoved << " to " << destinationFile;
+                    ret = fileSystem->move(fileToBeMoved, destinationFile, true);
+                    if (!ret) {
+                        return ret;
+                    }
+                }
 
-            for (const io::path_t& fileToBeMoved : filesToBeMoved.val) {
-                io::path_t destinationFile
-                    = io::path_t(targetContainerPath).appendingComponent(io::filename(fileToBeMoved));
-                LOGD() << fileToBeMoved << " to " << destinationFile;
-                ret = fileSystem()->move(fileToBeMoved, destinationFile, true);
+                // Try to remove the temp save folder (not problematic if fails)
+                ret = fileSystem->removeFolderIfEmpty(savePath);
+                if (!ret) {
+                    LOGW() << ret.toString();
+                }
+            } else {
+                Ret ret = fileSystem->move(savePath, targetContainerPath, true);
                 if (!ret) {
                     return ret;
                 }
             }
+        }
 
-            // Try to remove the temp save folder (not problematic if fails)
-            ret = fileSystem()->removeFolderIfEmpty(savePath);
-            if (!ret) {
-                LOGW() << ret.toString();
-            }
-        } else {
-            Ret ret = fileSystem()->move(savePath, targetContainerPath, true);
-            if (!ret) {
-                return ret;
-            }
+        // make file readable by all
+        {
+            QFile::setPermissions(targetMainFilePath.toQString(),
+                                  QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
         }
-    }
 
-    // make file readable by all
-    {
-        QFile::setPermissions(targetMainFilePath.toQString(),
-                              QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
-    }
+        LOGI() << "success save file: " << targetContainerPath;
+        return make_ret(Ret::Code::Ok);
+    };
 
-    LOGI() << "success save file: " << targetContainerPath;
-    return make_ret(Ret::Code::Ok);
+    return RetVal<SaveJob>::make_ok(job);
 }
 
 mu::Ret NotationProject::makeCurrentFileAsBackup()
@@ -646,7 +703,7 @@ mu::Ret NotationProject::makeCurrentFileAsBackup()
     return ret;
 }
 
-mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection)
+mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection, bool createThumbnail)
 {
     // Create MsczWriter
     bool ok = msczWriter.open();
@@ -656,7 +713,7 @@ mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection)
     }
 
     // Write engraving project
-    ok = m_engravingProject->writeMscz(msczWriter, onlySelection, true);
+    ok = m_engravingProject->writeMscz(msczWriter, onlySelection, createThumbnail);
     if (!ok) {
         LOGE() << "failed write engraving project to mscz";
         return make_ret(notation::Err::UnknownError);
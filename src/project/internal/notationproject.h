@@ -83,6 +83,7 @@ public:
 
     Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) override;
     Ret writeToDevice(QIODevice* device) override;
+    RetVal<SaveJob> prepareAutoSave(const io::path_t& path) override;
 
     ProjectMeta metaInfo() const override;
     void setMetaInfo(const ProjectMeta& meta, bool undoable = false) override;
@@ -102,8 +103,9 @@ private:
     Ret saveSelectionOnScore(const io::path_t& path = io::path_t());
     Ret exportProject(const io::path_t& path, const std::string& suffix);
     Ret doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode);
+    RetVal<SaveJob> prepareSave(const io::path_t& path, engraving::MscIoMode ioMode, bool isAutoSave);
     Ret makeCurrentFileAsBackup();
-    Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
+    Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection, bool createThumbnail = true);
 
     mu::engraving::EngravingProjectPtr m_engravingProject = nullptr;
     notation::MasterNotationPtr m_masterNotation = nullptr;
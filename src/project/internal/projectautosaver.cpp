@@ -21,6 +21,10 @@
  */
 #include "projectautosaver.h"
 
+#include <QElapsedTimer>
+
+#include "concurrency/taskscheduler.h"
+
 #include "engraving/infrastructure/mscio.h"
 
 #include "log.h"
@@ -90,6 +94,9 @@ void ProjectAutoSaver::removeProjectUnsavedChanges(const io::path_t& projectPath
         path = projectAutoSavePath(projectPath);
     }
 
+    //! NOTE Otherwise the pending save could write the autosave again after it is removed
+    waitForPendingSave();
+
     fileSystem()->remove(path);
 }
 
@@ -154,16 +161,57 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    if (isSaving()) {
+        LOGD() << "[autosave] previous autosave is still in progress";
+        return;
+    }
+
     io::path_t projectPath = this->projectPath(project);
     io::path_t savePath = project->isNewlyCreated() ? projectPath : projectAutoSavePath(projectPath);
 
-    Ret ret = project->save(savePath, SaveMode::AutoSave);
-    if (!ret) {
-        LOGE() << "[autosave] failed to save project, err: " << ret.toString();
+    //! NOTE Only the serialization of the project blocks the UI,
+    //! the compression and the writing to disk are done in the background
+    QElapsedTimer timer;
+    timer.start();
+
+    RetVal<SaveJob> job = project->prepareAutoSave(savePath);
+
+    LOGI() << "[autosave] UI thread blocked for " << timer.elapsed() << " ms";
+
+    if (!job.ret) {
+        LOGE() << "[autosave] failed to save project, err: " << job.ret.toString();
         return;
     }
 
-    LOGD() << "[autosave] successfully saved project";
+    m_pendingSave = TaskScheduler::instance()->submitWithPriority(TaskPriority::Background, [job = job.val]() {
+        QElapsedTimer timer;
+        timer.start();
+
+        Ret ret = job();
+        if (!ret) {
+            LOGE() << "[autosave] failed to save project, err: " << ret.toString();
+            return ret;
+        }
+
+        LOGI() << "[autosave] successfully saved project in background, took " << timer.elapsed() << " ms";
+        return ret;
+    });
+}
+
+bool ProjectAutoSaver::isSaving() const
+{
+    return m_pendingSave.valid() && m_pendingSave.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+void ProjectAutoSaver::waitForPendingSave()
+{
+    if (!m_pendingSave.valid()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    m_pendingSave.get();
 }
 
 mu::io::path_t ProjectAutoSaver::projectPath(INotationProjectPtr project) const
@@ -22,11 +22,14 @@
 #ifndef MU_PROJECT_PROJECTAUTOSAVER_H
 #define MU_PROJECT_PROJECTAUTOSAVER_H
 
+#include <future>
+
 #include <QTimer>
 
 #include "async/asyncable.h"
 
 #include "modularity/ioc.h"
+#include "types/ret.h"
 #include "context/iglobalcontext.h"
 #include "io/ifilesystem.h"
 #include "iprojectconfiguration.h"
@@ -59,11 +62,16 @@ private:
     void update();
 
     void onTrySave();
+    bool isSaving() const;
+    void waitForPendingSave();
 
     io::path_t projectPath(INotationProjectPtr project) const;
 
     QTimer m_timer;
     io::path_t m_lastProjectPathNeedingAutosave;
+
+    //! NOTE The autosave is stored in the background, see onTrySave()
+    std::future<Ret> m_pendingSave;
 };
 }
 
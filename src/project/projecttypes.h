@@ -22,12 +22,14 @@
 #ifndef MU_PROJECT_PROJECTTYPES_H
 #define MU_PROJECT_PROJECTTYPES_H
 
+#include <functional>
 #include <variant>
 
 #include <QString>
 #include <QUrl>
 
 #include "io/path.h"
+#include "types/ret.h"
 #include "log.h"
 
 #include "cloud/cloudtypes.h"
@@ -69,6 +71,10 @@ enum class SaveMode
     AutoSave
 };
 
+//! NOTE Compresses the project, which is already written to memory, and stores it to the disk.
+//! It doesn't touch the project, so it may be run on another thread
+using SaveJob = std::function<Ret()>;
+
 enum class SaveLocationType
 {
     Undefined,